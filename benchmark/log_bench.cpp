@@ -0,0 +1,154 @@
+#include "log.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Hand-rolled benchmark harness for the log library.
+ *
+ * Measures, with wall-clock timing over a fixed iteration count:
+ * \li single-threaded Log::write() latency per sink type (std::ostream*,
+ * std::filesystem::path, FileSink, callback)
+ * \li multi-threaded contention scaling at 2/8/32/64 producer threads
+ * \li LogEvent construction cost
+ * \li LogEvent::toString() cost with and without a custom formatter
+ *
+ * Results are printed as "name: ns/op (ops/s)" so successive releases can be
+ * compared with a diff.
+ */
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Result {
+        double nanoseconds_per_op;
+        double ops_per_second;
+    };
+
+    template < class Body > auto measure(const size_t p_iterations, Body&& p_body) -> Result {
+        const auto l_start = Clock::now();
+        for (size_t i = 0; i < p_iterations; ++i) {
+            p_body();
+        }
+        const auto l_elapsed = std::chrono::duration_cast< std::chrono::nanoseconds >(Clock::now() - l_start).count();
+        const auto l_per_op = static_cast< double >(l_elapsed) / static_cast< double >(p_iterations);
+        return {l_per_op, 1e9 / l_per_op};
+    }
+
+    void report(const char* p_name, const Result p_result) {
+        std::printf("%-48s %10.1f ns/op %14.0f ops/s\n", p_name, p_result.nanoseconds_per_op, p_result.ops_per_second);
+    }
+
+    auto makeEvent() -> mt::log::LogEvent {
+        return {"benchmark message of a fairly typical length", mt::log::MessageType::Info, std::source_location::current()};
+    }
+
+    void benchEventConstruction(const size_t p_iterations) {
+        report("LogEvent construction", measure(p_iterations, []() -> void {
+                   const auto l_event = makeEvent();
+                   static_cast< void >(l_event);
+               }));
+    }
+
+    void benchToString(const size_t p_iterations) {
+        const auto l_event = makeEvent();
+        report("toString default format", measure(p_iterations, [&l_event]() -> void {
+                   static_cast< void >(l_event.toString());
+               }));
+        const std::function< std::string(const mt::log::LogEvent&) > l_formatter = [](const mt::log::LogEvent& p_event) -> std::string {
+            std::string l_line{p_event.message_type_string};
+            l_line += ": ";
+            l_line += p_event.message.view();
+            l_line += '\n';
+            return l_line;
+        };
+        report("toString custom formatter", measure(p_iterations, [&l_event, &l_formatter]() -> void {
+                   static_cast< void >(l_event.toString(l_formatter));
+               }));
+    }
+
+    void benchSingleThreadedSinks(const size_t p_iterations) {
+        {
+            std::ofstream l_null{"/dev/null"};
+            mt::log::Log l_log;
+            l_log.setGlobalOutput(static_cast< std::ostream* >(&l_null));
+            report("write std::ostream*", measure(p_iterations, [&l_log]() -> void {
+                       l_log.write(makeEvent());
+                   }));
+        }
+        const auto l_file = std::filesystem::temp_directory_path() / "log_bench_path.log";
+        {
+            mt::log::Log l_log;
+            l_log.setGlobalOutput(l_file);
+            report("write std::filesystem::path", measure(p_iterations / 10, [&l_log]() -> void {
+                       l_log.write(makeEvent());
+                   }));
+        }
+        std::filesystem::remove(l_file);
+        const auto l_sink_file = std::filesystem::temp_directory_path() / "log_bench_sink.log";
+        {
+            mt::log::Log l_log;
+            l_log.setGlobalOutput(std::make_shared< mt::log::FileSink >(l_sink_file));
+            report("write FileSink", measure(p_iterations, [&l_log]() -> void {
+                       l_log.write(makeEvent());
+                   }));
+        }
+        std::filesystem::remove(l_sink_file);
+        {
+            mt::log::Log l_log;
+            size_t l_bytes = 0;
+            l_log.setGlobalOutput([&l_bytes](const std::string& p_message) -> void {
+                l_bytes += p_message.size();
+            });
+            report("write callback", measure(p_iterations, [&l_log]() -> void {
+                       l_log.write(makeEvent());
+                   }));
+        }
+    }
+
+    void benchContention(const size_t p_iterations_per_thread) {
+        for (const size_t l_thread_count: {size_t{2}, size_t{8}, size_t{32}, size_t{64}}) {
+            mt::log::Log l_log;
+            size_t l_bytes = 0;
+            l_log.setGlobalOutput([&l_bytes](const std::string& p_message) -> void {
+                l_bytes += p_message.size();
+            });
+            std::vector< std::thread > l_threads;
+            l_threads.reserve(l_thread_count);
+            const auto l_start = Clock::now();
+            for (size_t t = 0; t < l_thread_count; ++t) {
+                l_threads.emplace_back([&l_log, p_iterations_per_thread]() -> void {
+                    for (size_t i = 0; i < p_iterations_per_thread; ++i) {
+                        l_log.write(makeEvent());
+                    }
+                });
+            }
+            for (auto& l_thread: l_threads) {
+                l_thread.join();
+            }
+            const auto l_elapsed = std::chrono::duration_cast< std::chrono::nanoseconds >(Clock::now() - l_start).count();
+            const auto l_total = static_cast< double >(l_thread_count * p_iterations_per_thread);
+            char l_name[64];
+            std::snprintf(l_name, sizeof(l_name), "write contention, %zu threads", l_thread_count);
+            report(l_name, {static_cast< double >(l_elapsed) / l_total, l_total * 1e9 / static_cast< double >(l_elapsed)});
+        }
+    }
+
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+    size_t l_iterations = 100000;
+    if (argc > 1) {
+        l_iterations = static_cast< size_t >(std::strtoull(argv[1], nullptr, 10));
+    }
+    benchEventConstruction(l_iterations);
+    benchToString(l_iterations);
+    benchSingleThreadedSinks(l_iterations);
+    benchContention(l_iterations / 10);
+    return 0;
+}
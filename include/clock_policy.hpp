@@ -0,0 +1,117 @@
+#ifndef MT_CLOCK_POLICY_HPP
+#define MT_CLOCK_POLICY_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if (defined __linux) || (defined linux) || (defined __linux__)
+  #include <ctime>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+  #else
+    #include <x86intrin.h>
+  #endif
+#endif
+
+namespace mt::log {
+
+    /**
+     * \struct SystemClockPolicy
+     * \brief The default clock policy: one std::chrono::system_clock::now()
+     * (a vDSO call on Linux) per event. Wall-clock accurate, including steps
+     * from NTP adjustments.
+     *
+     * Clock policies are stateless types with a static now() returning a
+     * system_clock time point; the one in use is selected through the
+     * ClockPolicy template parameter of Log, so the choice costs nothing at
+     * the call site.
+     */
+    struct SystemClockPolicy {
+        static auto now() -> std::chrono::system_clock::time_point { return std::chrono::system_clock::now(); }
+    };
+
+    /**
+     * \struct SteadyClockPolicy
+     * \brief Monotonic timestamps mapped onto the system epoch once at first
+     * use.
+     *
+     * Events stamped with this policy never go backwards across wall-clock
+     * steps, at the price of drifting from wall time by whatever the system
+     * clock is adjusted by after the mapping is taken.
+     */
+    struct SteadyClockPolicy {
+        static auto now() -> std::chrono::system_clock::time_point {
+            static const auto system_base = std::chrono::system_clock::now();
+            static const auto steady_base = std::chrono::steady_clock::now();
+            return system_base + std::chrono::duration_cast< std::chrono::system_clock::duration >(std::chrono::steady_clock::now() - steady_base);
+        }
+    };
+
+    /**
+     * \struct CoarseClockPolicy
+     * \brief CLOCK_REALTIME_COARSE timestamps: tick resolution (typically
+     * 1-4ms) for less cost than the precise vDSO path. Falls back to
+     * system_clock where the coarse clock does not exist.
+     *
+     * The right trade for high-frequency Trace, where millisecond-grain
+     * timestamps are plenty and capture cost dominates.
+     */
+    struct CoarseClockPolicy {
+        static auto now() -> std::chrono::system_clock::time_point {
+#if ((defined __linux) || (defined linux) || (defined __linux__)) && defined(CLOCK_REALTIME_COARSE)
+            timespec l_now {};
+            ::clock_gettime(CLOCK_REALTIME_COARSE, &l_now);
+            return std::chrono::system_clock::time_point(std::chrono::duration_cast< std::chrono::system_clock::duration >(
+                std::chrono::seconds(l_now.tv_sec) + std::chrono::nanoseconds(l_now.tv_nsec)));
+#else
+            return std::chrono::system_clock::now();
+#endif
+        }
+    };
+
+    /**
+     * \struct TscClockPolicy
+     * \brief Timestamps from the CPU cycle counter, calibrated against the
+     * system clock once at first use; the cheapest source per call on x86.
+     *
+     * Calibration sleeps for a few milliseconds to measure the tick rate, so
+     * the first stamped event pays that once. Assumes an invariant TSC
+     * (constant rate, synchronized across cores — any x86 from the last
+     * decade); drifts from wall time like SteadyClockPolicy. On non-x86
+     * builds this degrades to SteadyClockPolicy.
+     */
+    struct TscClockPolicy {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        static auto now() -> std::chrono::system_clock::time_point {
+            struct Calibration {
+                uint64_t base_tick;
+                std::chrono::system_clock::time_point base_time;
+                double nanoseconds_per_tick;
+            };
+            static const Calibration calibration = []() -> Calibration {
+                const auto first_tick = __rdtsc();
+                const auto first_time = std::chrono::steady_clock::now();
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                const auto second_tick = __rdtsc();
+                const auto second_time = std::chrono::steady_clock::now();
+                const auto elapsed_ns = std::chrono::duration_cast< std::chrono::nanoseconds >(second_time - first_time).count();
+                return {second_tick, std::chrono::system_clock::now(),
+                        static_cast< double >(elapsed_ns) / static_cast< double >(second_tick - first_tick)};
+            }();
+            const auto l_ticks = __rdtsc() - calibration.base_tick;
+            return calibration.base_time
+                 + std::chrono::duration_cast< std::chrono::system_clock::duration >(
+                       std::chrono::nanoseconds(static_cast< int64_t >(static_cast< double >(l_ticks) * calibration.nanoseconds_per_tick)));
+        }
+#else
+        static auto now() -> std::chrono::system_clock::time_point { return SteadyClockPolicy::now(); }
+#endif
+    };
+
+}  // namespace mt::log
+
+#endif  // MT_CLOCK_POLICY_HPP
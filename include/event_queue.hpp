@@ -0,0 +1,173 @@
+#ifndef MT_EVENT_QUEUE_HPP
+#define MT_EVENT_QUEUE_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace mt::log {
+
+    /**
+     * \enum OverflowPolicy
+     * \brief Behaviour of a bounded queue when a push finds the queue full.
+     *
+     * \li Block      - the producer waits until the consumer frees a slot.
+     * \li DropOldest - the oldest queued event is discarded to make room.
+     * \li DropNewest - the incoming event is discarded.
+     */
+    enum class OverflowPolicy : uint8_t {
+        Block,
+        DropOldest,
+        DropNewest
+    };
+
+    /**
+     * \class EventQueue
+     * \brief Bounded multi-producer single-consumer queue used as the hand-off
+     * point between Log::write() callers and the background writer thread.
+     *
+     * Producers push events under a mutex and the single consumer drains the
+     * queue in batches. The queue is bounded; the reaction to overflow is
+     * selected via OverflowPolicy at construction time.
+     */
+    template < class Event > class EventQueue {
+    public:
+        EventQueue(const size_t p_capacity, const OverflowPolicy p_policy) :
+            m_capacity(p_capacity == 0 ? 1 : p_capacity),
+            m_policy(p_policy) { }
+
+        EventQueue(const EventQueue&) = delete;
+        EventQueue(EventQueue&&) = delete;
+        EventQueue& operator=(const EventQueue&) = delete;
+        EventQueue& operator=(EventQueue&&) = delete;
+
+        /**
+         * \brief Enqueues an event, applying the overflow policy when full.
+         * \param p_event Event&&
+         * \return false if the event was dropped or the queue is closed, true otherwise.
+         */
+        auto push(Event&& p_event) -> bool {
+            std::unique_lock lock(m_mutex);
+            if (m_closed) {
+                return false;
+            }
+            if (m_events.size() >= m_capacity) {
+                switch (m_policy) {
+                    case OverflowPolicy::Block : {
+                        m_not_full.wait(lock, [this]() -> bool {
+                            return m_events.size() < m_capacity or m_closed;
+                        });
+                        if (m_closed) {
+                            return false;
+                        }
+                        break;
+                    }
+                    case OverflowPolicy::DropOldest : {
+                        m_events.pop_front();
+                        ++m_dropped;
+                        break;
+                    }
+                    case OverflowPolicy::DropNewest : {
+                        ++m_dropped;
+                        return false;
+                    }
+                }
+            }
+            m_events.emplace_back(std::move(p_event));
+            m_not_empty.notify_one();
+            return true;
+        }
+
+        /**
+         * \brief Waits for pending events and moves all of them into [p_batch].
+         *
+         * The queue is marked as draining until the consumer acknowledges the
+         * batch via drainComplete(), which keeps waitUntilEmpty() honest about
+         * events that are popped but not yet written.
+         *
+         * \param p_batch std::vector\<Event\>&
+         * \return false when the queue is closed and fully drained, true otherwise.
+         */
+        auto popBatch(std::vector< Event >& p_batch) -> bool {
+            std::unique_lock lock(m_mutex);
+            m_not_empty.wait(lock, [this]() -> bool {
+                return not m_events.empty() or m_closed;
+            });
+            if (m_events.empty() and m_closed) {
+                return false;
+            }
+            p_batch.clear();
+            while (not m_events.empty()) {
+                p_batch.emplace_back(std::move(m_events.front()));
+                m_events.pop_front();
+            }
+            m_draining = true;
+            m_not_full.notify_all();
+            return true;
+        }
+
+        /**
+         * \brief Number of currently queued events.
+         */
+        [[nodiscard]] auto size() -> size_t {
+            std::scoped_lock lock(m_mutex);
+            return m_events.size();
+        }
+
+        /**
+         * \brief Events discarded by the overflow policy since construction.
+         */
+        [[nodiscard]] auto dropped() -> uint64_t {
+            std::scoped_lock lock(m_mutex);
+            return m_dropped;
+        }
+
+        /**
+         * \brief Acknowledges that the last popped batch has been written out.
+         */
+        void drainComplete() {
+            std::scoped_lock lock(m_mutex);
+            m_draining = false;
+            m_empty.notify_all();
+        }
+
+        /**
+         * \brief Blocks until every queued event has been popped and written.
+         */
+        void waitUntilEmpty() {
+            std::unique_lock lock(m_mutex);
+            m_empty.wait(lock, [this]() -> bool {
+                return m_events.empty() and not m_draining;
+            });
+        }
+
+        /**
+         * \brief Closes the queue. Pending events remain poppable; further
+         * pushes are rejected and blocked producers are released.
+         */
+        void close() {
+            std::scoped_lock lock(m_mutex);
+            m_closed = true;
+            m_not_empty.notify_all();
+            m_not_full.notify_all();
+            m_empty.notify_all();
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_not_empty;
+        std::condition_variable m_not_full;
+        std::condition_variable m_empty;
+        std::deque< Event > m_events;
+        size_t m_capacity;
+        OverflowPolicy m_policy;
+        bool m_draining{false};
+        uint64_t m_dropped{0};
+        bool m_closed{false};
+    };
+
+}  // namespace mt::log
+
+#endif  // MT_EVENT_QUEUE_HPP
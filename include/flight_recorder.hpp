@@ -0,0 +1,80 @@
+#ifndef MT_FLIGHT_RECORDER_HPP
+#define MT_FLIGHT_RECORDER_HPP
+
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace mt::log {
+
+    struct LogEvent;
+
+    /**
+     * \class FlightRecorderSink
+     * \brief In-memory ring of the most recent events, formatted only when
+     * dumped.
+     *
+     * Intended for always-on Trace: instead of paying formatting and I/O for
+     * every message (or compiling the level out entirely), events are
+     * retained in binary form in a fixed-size circular buffer at near-zero
+     * steady-state cost, and the recent history is written out formatted on
+     * demand — via dump(), or automatically when a Fatal event passes through
+     * the owning Log instance and a fatal dump target was configured.
+     *
+     * The sink locks internally, since dump() may be called from any thread
+     * while the writer is recording.
+     */
+    class FlightRecorderSink {
+    public:
+        /**
+         * \brief Creates a recorder retaining the last [p_capacity] events.
+         * \param p_capacity size_t
+         * \param p_fatal_dump_target std::ostream* - stream the history is
+         * dumped to when a Fatal event fires; nullptr disables the automatic
+         * dump.
+         */
+        explicit FlightRecorderSink(size_t p_capacity = 4096, std::ostream* p_fatal_dump_target = nullptr);
+
+        FlightRecorderSink(const FlightRecorderSink& other) = delete;
+        FlightRecorderSink(FlightRecorderSink&& other) = delete;
+        FlightRecorderSink& operator=(const FlightRecorderSink& other) = delete;
+        FlightRecorderSink& operator=(FlightRecorderSink&& other) = delete;
+
+        ~FlightRecorderSink();
+
+        /**
+         * \brief Retains the event, overwriting the oldest one when the ring
+         * is full. No formatting happens here.
+         * \param p_log_event LogEvent&&
+         */
+        void record(LogEvent&& p_log_event);
+
+        /**
+         * \brief Writes the retained history, oldest first, formatted to
+         * [p_out]. The history is kept, so repeated dumps are possible.
+         * \param p_out std::ostream&
+         * \param p_formatter const std::function\<std::string(const LogEvent&)\>& -
+         * optional custom formatter; the default layout is used when empty.
+         */
+        void dump(std::ostream& p_out, const std::function< std::string(const LogEvent&) >& p_formatter = {});
+
+        /**
+         * \brief Dumps to the configured fatal dump target, if any. Called by
+         * Log when a Fatal event fires.
+         */
+        void dumpOnFatal();
+
+    private:
+        mutable std::mutex m_mutex;
+        std::vector< std::optional< LogEvent > > m_events;
+        size_t m_head{0};
+        size_t m_size{0};
+        std::ostream* m_fatal_dump_target{nullptr};
+    };
+
+}  // namespace mt::log
+
+#endif  // MT_FLIGHT_RECORDER_HPP
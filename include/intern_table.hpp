@@ -0,0 +1,102 @@
+#ifndef MT_INTERN_TABLE_HPP
+#define MT_INTERN_TABLE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+
+namespace mt::log {
+
+    /**
+     * \class InternTable
+     * \brief Process-wide table mapping source-location string pointers to
+     * small integer ids.
+     *
+     * std::source_location hands out pointers into static storage, and a
+     * binary only ever contains a small set of distinct file and function
+     * names, so keying on the pointer itself makes interning a read-mostly
+     * hash probe: the fast path is a couple of relaxed/acquire atomic loads
+     * with no lock, and only the first sighting of a pointer takes a mutex to
+     * publish its id. LogEvent records the ids at capture time; formatters and
+     * the binary format resolve them back through resolve() at output time.
+     *
+     * Id 0 is reserved for "not interned" (strings that did not come from
+     * static storage).
+     */
+    class InternTable {
+    public:
+        static constexpr size_t table_capacity = 4096;
+
+        static auto instance() -> InternTable& {
+            static InternTable table;
+            return table;
+        }
+
+        /**
+         * \brief Returns the id of the string at [p_string], assigning one on
+         * first sight.
+         *
+         * Only safe for pointers with static storage duration; the table keeps
+         * the view alive for the process lifetime.
+         *
+         * \param p_string const char*
+         * \return uint32_t - 0 if [p_string] is null or the table is full.
+         */
+        auto internPointer(const char* p_string) -> uint32_t {
+            if (p_string == nullptr) {
+                return 0;
+            }
+            auto index = (reinterpret_cast< uintptr_t >(p_string) >> 4) & (table_capacity - 1);
+            for (size_t probe = 0; probe < table_capacity; ++probe) {
+                const char* key = m_keys[index].load(std::memory_order_acquire);
+                if (key == p_string) {
+                    return m_ids[index];
+                }
+                if (key == nullptr) {
+                    std::scoped_lock lock(m_mutex);
+                    key = m_keys[index].load(std::memory_order_relaxed);
+                    if (key == nullptr) {
+                        if (m_next_id > table_capacity) {
+                            return 0;
+                        }
+                        const auto id = m_next_id++;
+                        m_ids[index] = id;
+                        m_by_id[id - 1] = std::string_view{p_string};
+                        m_keys[index].store(p_string, std::memory_order_release);
+                        return id;
+                    }
+                    if (key == p_string) {
+                        return m_ids[index];
+                    }
+                }
+                index = (index + 1) & (table_capacity - 1);
+            }
+            return 0;
+        }
+
+        /**
+         * \brief Resolves an id back to its string.
+         * \param p_id uint32_t
+         * \return std::string_view - empty for id 0 or unknown ids.
+         */
+        [[nodiscard]] auto resolve(const uint32_t p_id) const -> std::string_view {
+            if (p_id == 0 or p_id > table_capacity) {
+                return {};
+            }
+            return m_by_id[p_id - 1];
+        }
+
+    private:
+        InternTable() = default;
+
+        std::atomic< const char* > m_keys[table_capacity]{};
+        uint32_t m_ids[table_capacity]{};
+        std::string_view m_by_id[table_capacity]{};
+        std::mutex m_mutex;
+        uint32_t m_next_id{1};
+    };
+
+}  // namespace mt::log
+
+#endif  // MT_INTERN_TABLE_HPP
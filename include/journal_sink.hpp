@@ -0,0 +1,146 @@
+#ifndef MT_JOURNAL_SINK_HPP
+#define MT_JOURNAL_SINK_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string_view>
+#include <thread>
+
+namespace mt::log {
+
+    /**
+     * \struct JournalOptions
+     * \brief Preallocation and group-commit tuning for a JournalSink.
+     *
+     * A commit happens when [commit_records] records have accumulated since
+     * the last one, when [commit_interval] elapses with records pending, or
+     * immediately when a durable write or flush() is waiting — whichever
+     * comes first, so the loss window is bounded by the interval while a
+     * sustained burst pays one fsync per [commit_records] messages.
+     */
+    struct JournalOptions {
+        size_t journal_size{64 * 1024 * 1024};
+        std::chrono::milliseconds commit_interval{std::chrono::milliseconds(5)};
+        size_t commit_records{64};
+    };
+
+    /**
+     * \class JournalSink
+     * \brief Write-ahead journal for audit trails that must survive power
+     * loss: length-prefixed, checksummed records in a preallocated file,
+     * made durable by group-commit fsync instead of an fsync per message.
+     *
+     * Each write() appends one record — [uint32_t length][uint32_t crc32]
+     * [payload] — with a positioned write into the page cache; a background
+     * committer thread fsyncs on the JournalOptions group-commit schedule,
+     * so a crash loses at most the records of one commit window. The file
+     * is preallocated (and extended) in [journal_size] steps so commits do
+     * not wait on block allocation. A write marked durable blocks until the
+     * group holding its record has committed, giving per-message durability
+     * at amortized group cost when several durable writers overlap.
+     *
+     * Recovery reads records sequentially and stops at the first length or
+     * checksum that does not verify, so a record torn by the crash is
+     * skipped rather than replayed corrupt. Reopening an existing journal
+     * resumes appending after the last valid record.
+     *
+     * JournalSink serializes its own appends; the owning Log does not take
+     * its emit lock around it.
+     */
+    class JournalSink {
+    public:
+        /**
+         * \brief Opens (or resumes) the journal at [p_path] and starts the
+         * committer thread.
+         * \param p_path std::filesystem::path
+         * \param p_options JournalOptions
+         * \throws std::system_error if the journal can not be created,
+         * preallocated or scanned.
+         */
+        explicit JournalSink(std::filesystem::path p_path, JournalOptions p_options = {});
+
+        JournalSink(const JournalSink&) = delete;
+        JournalSink(JournalSink&&) = delete;
+        JournalSink& operator=(const JournalSink&) = delete;
+        JournalSink& operator=(JournalSink&&) = delete;
+
+        /**
+         * \brief Commits whatever is pending, stops the committer thread and
+         * closes the journal.
+         */
+        ~JournalSink();
+
+        /**
+         * \brief Appends one record. With [p_durable] false the call returns
+         * once the record is in the page cache and the group-commit schedule
+         * bounds the loss window; with [p_durable] true it blocks until the
+         * commit covering the record has reached the device.
+         * \param p_message std::string_view
+         * \param p_durable bool
+         */
+        void write(std::string_view p_message, bool p_durable = false);
+
+        /**
+         * \brief Blocks until every record appended so far is committed.
+         */
+        void flush();
+
+        /**
+         * \brief Records made durable since the journal was opened or
+         * resumed.
+         */
+        [[nodiscard]] auto committedRecords() const -> uint64_t { return m_committed_visible.load(std::memory_order_relaxed); }
+
+        /**
+         * \brief Group commits performed; the ratio of committedRecords() to
+         * this is the fsync amortization actually achieved.
+         */
+        [[nodiscard]] auto commitCount() const -> uint64_t { return m_commit_count.load(std::memory_order_relaxed); }
+
+        /**
+         * \brief Replays the valid records of the journal at [p_path] into
+         * [p_consume] in append order, stopping at the first record whose
+         * length or checksum does not verify (the torn tail).
+         * \param p_path const std::filesystem::path&
+         * \param p_consume const std::function\<void(std::string_view)\>&
+         * \return uint64_t - the number of valid records replayed.
+         * \throws std::system_error if the journal can not be opened.
+         */
+        static auto recover(const std::filesystem::path& p_path, const std::function< void(std::string_view) >& p_consume) -> uint64_t;
+
+    private:
+        void preallocate(uint64_t p_up_to);
+        void committerLoop();
+        void commitLocked(std::unique_lock< std::mutex >& p_lock);
+
+        std::filesystem::path m_path;
+        JournalOptions m_options;
+        int m_fd{-1};
+        uint64_t m_cursor{0};
+        uint64_t m_allocated{0};
+
+        std::mutex m_mutex;
+        std::condition_variable m_committer_wakeup;
+        std::condition_variable m_commit_done;
+        uint64_t m_appended{0};
+        uint64_t m_committed{0};
+        bool m_commit_requested{false};
+        bool m_stop{false};
+        std::atomic< uint64_t > m_committed_visible{0};
+        std::atomic< uint64_t > m_commit_count{0};
+
+        std::thread m_committer;
+    };
+
+}  // namespace mt::log
+
+#if defined(MT_LOG_HEADER_ONLY)
+  #include "journal_sink.ipp"
+#endif
+
+#endif  // MT_JOURNAL_SINK_HPP
@@ -0,0 +1,385 @@
+/**
+ * \file journal_sink.ipp
+ * \brief Out-of-line definitions for journal_sink.hpp.
+ *
+ * Compiled once into the log library in the default build; included
+ * inline by the headers when MT_LOG_HEADER_ONLY is defined (the header-only
+ * CMake target does this), so short-lived tools can skip the library link.
+ */
+#ifndef MT_JOURNAL_SINK_IPP
+#define MT_JOURNAL_SINK_IPP
+
+#include "journal_sink.hpp"
+
+#include <array>
+#include <cstring>
+#include <string>
+#include <system_error>
+
+#if (defined __linux) || (defined linux) || (defined __linux__) || (defined __OSX__) || (defined __APPLE__)
+  #include <fcntl.h>
+  #include <sys/stat.h>
+  #include <sys/uio.h>
+  #include <unistd.h>
+#else
+  #define NOMINMAX
+  #include <windows.h>
+#endif
+
+
+#ifndef MT_LOG_FUNC
+  #if defined(MT_LOG_HEADER_ONLY)
+    #define MT_LOG_FUNC inline
+  #else
+    #define MT_LOG_FUNC
+  #endif
+#endif
+
+namespace mt::log {
+
+    namespace journal_detail {
+
+        inline constexpr char journal_magic[8] = {'M', 'T', 'L', 'O', 'G', 'J', 'R', 'N'};
+        inline constexpr uint64_t header_size = 64;
+        inline constexpr size_t record_header_size = sizeof(uint32_t) * 2;
+
+        /**
+         * \internal
+         * \brief Reflected CRC-32 (the zlib/PNG polynomial), table generated
+         * at compile time.
+         */
+        inline constexpr std::array< uint32_t, 256 > crc_table = []() {
+            std::array< uint32_t, 256 > l_table{};
+            for (uint32_t l_index = 0; l_index < 256; ++l_index) {
+                uint32_t l_value = l_index;
+                for (int l_bit = 0; l_bit < 8; ++l_bit) {
+                    l_value = (l_value >> 1) ^ ((l_value & 1) ? 0xEDB88320u : 0u);
+                }
+                l_table[l_index] = l_value;
+            }
+            return l_table;
+        }();
+
+        MT_LOG_FUNC auto crc32(const char* p_data, const size_t p_size) -> uint32_t {
+            uint32_t l_crc = 0xFFFFFFFFu;
+            for (size_t l_index = 0; l_index < p_size; ++l_index) {
+                l_crc = (l_crc >> 8) ^ crc_table[(l_crc ^ static_cast< uint8_t >(p_data[l_index])) & 0xFFu];
+            }
+            return l_crc ^ 0xFFFFFFFFu;
+        }
+
+        [[noreturn]] MT_LOG_FUNC void throwErrno(const char* p_what) { throw std::system_error(errno, std::system_category(), p_what); }
+
+#if (defined __linux) || (defined linux) || (defined __linux__) || (defined __OSX__) || (defined __APPLE__)
+
+        MT_LOG_FUNC auto readAt(const int p_fd, void* p_buffer, const size_t p_size, const uint64_t p_offset) -> bool {
+            size_t l_done = 0;
+            while (l_done < p_size) {
+                const auto l_read = ::pread(p_fd, static_cast< char* >(p_buffer) + l_done, p_size - l_done, static_cast< off_t >(p_offset + l_done));
+                if (l_read <= 0) {
+                    return false;
+                }
+                l_done += static_cast< size_t >(l_read);
+            }
+            return true;
+        }
+
+        MT_LOG_FUNC void writeAt(const int p_fd, const void* p_header, const size_t p_header_size, const void* p_payload, const size_t p_payload_size,
+                                 const uint64_t p_offset) {
+            iovec l_parts[2] = {{const_cast< void* >(p_header), p_header_size}, {const_cast< void* >(p_payload), p_payload_size}};
+            size_t l_done = 0;
+            const auto l_total = p_header_size + p_payload_size;
+            while (l_done < l_total) {
+                const auto l_written = l_done < p_header_size
+                                         ? ::pwritev(p_fd, l_parts, 2, static_cast< off_t >(p_offset + l_done))
+                                         : ::pwrite(p_fd, static_cast< const char* >(p_payload) + (l_done - p_header_size), l_total - l_done,
+                                                    static_cast< off_t >(p_offset + l_done));
+                if (l_written < 0) {
+                    throwErrno("JournalSink: pwrite");
+                }
+                l_done += static_cast< size_t >(l_written);
+                if (l_done > 0 and l_done < p_header_size) {
+                    l_parts[0].iov_base = static_cast< char* >(const_cast< void* >(p_header)) + l_done;
+                    l_parts[0].iov_len = p_header_size - l_done;
+                }
+            }
+        }
+
+        MT_LOG_FUNC void syncData(const int p_fd) {
+  #if (defined __linux) || (defined linux) || (defined __linux__)
+            if (::fdatasync(p_fd) != 0) {
+                throwErrno("JournalSink: fdatasync");
+            }
+  #else
+            if (::fsync(p_fd) != 0) {
+                throwErrno("JournalSink: fsync");
+            }
+  #endif
+        }
+
+        MT_LOG_FUNC void growTo(const int p_fd, const uint64_t p_size) {
+  #if (defined __linux) || (defined linux) || (defined __linux__)
+            if (const auto l_error = ::posix_fallocate(p_fd, 0, static_cast< off_t >(p_size)); l_error != 0 and l_error != EOPNOTSUPP) {
+                errno = l_error;
+                throwErrno("JournalSink: posix_fallocate");
+            } else if (l_error == EOPNOTSUPP and ::ftruncate(p_fd, static_cast< off_t >(p_size)) != 0) {
+                throwErrno("JournalSink: ftruncate");
+            }
+  #else
+            if (::ftruncate(p_fd, static_cast< off_t >(p_size)) != 0) {
+                throwErrno("JournalSink: ftruncate");
+            }
+  #endif
+        }
+
+        MT_LOG_FUNC auto fileSize(const int p_fd) -> uint64_t {
+            struct stat l_stat{};
+            if (::fstat(p_fd, &l_stat) != 0) {
+                throwErrno("JournalSink: fstat");
+            }
+            return static_cast< uint64_t >(l_stat.st_size);
+        }
+
+        MT_LOG_FUNC auto openJournal(const std::filesystem::path& p_path, const bool p_read_only) -> int {
+            const auto l_fd = ::open(p_path.c_str(), p_read_only ? O_RDONLY : (O_RDWR | O_CREAT), 0644);
+            if (l_fd < 0) {
+                throwErrno("JournalSink: open");
+            }
+            return l_fd;
+        }
+
+        MT_LOG_FUNC void closeJournal(const int p_fd) { ::close(p_fd); }
+
+#else
+
+        MT_LOG_FUNC auto toHandle(const int p_fd) -> HANDLE { return reinterpret_cast< HANDLE >(static_cast< intptr_t >(p_fd)); }
+
+        MT_LOG_FUNC auto readAt(const int p_fd, void* p_buffer, const size_t p_size, const uint64_t p_offset) -> bool {
+            OVERLAPPED l_position{};
+            l_position.Offset = static_cast< DWORD >(p_offset);
+            l_position.OffsetHigh = static_cast< DWORD >(p_offset >> 32);
+            DWORD l_read = 0;
+            return ReadFile(toHandle(p_fd), p_buffer, static_cast< DWORD >(p_size), &l_read, &l_position) and l_read == p_size;
+        }
+
+        MT_LOG_FUNC void writeAt(const int p_fd, const void* p_header, const size_t p_header_size, const void* p_payload, const size_t p_payload_size,
+                                 const uint64_t p_offset) {
+            const void* l_parts[2] = {p_header, p_payload};
+            const size_t l_sizes[2] = {p_header_size, p_payload_size};
+            uint64_t l_offset = p_offset;
+            for (size_t l_index = 0; l_index < 2; ++l_index) {
+                OVERLAPPED l_position{};
+                l_position.Offset = static_cast< DWORD >(l_offset);
+                l_position.OffsetHigh = static_cast< DWORD >(l_offset >> 32);
+                DWORD l_written = 0;
+                if (not WriteFile(toHandle(p_fd), l_parts[l_index], static_cast< DWORD >(l_sizes[l_index]), &l_written, &l_position)
+                    or l_written != l_sizes[l_index]) {
+                    throw std::system_error(static_cast< int >(GetLastError()), std::system_category(), "JournalSink: WriteFile");
+                }
+                l_offset += l_sizes[l_index];
+            }
+        }
+
+        MT_LOG_FUNC void syncData(const int p_fd) {
+            if (not FlushFileBuffers(toHandle(p_fd))) {
+                throw std::system_error(static_cast< int >(GetLastError()), std::system_category(), "JournalSink: FlushFileBuffers");
+            }
+        }
+
+        MT_LOG_FUNC void growTo(const int p_fd, const uint64_t p_size) {
+            LARGE_INTEGER l_position;
+            l_position.QuadPart = static_cast< LONGLONG >(p_size);
+            if (not SetFilePointerEx(toHandle(p_fd), l_position, nullptr, FILE_BEGIN) or not SetEndOfFile(toHandle(p_fd))) {
+                throw std::system_error(static_cast< int >(GetLastError()), std::system_category(), "JournalSink: SetEndOfFile");
+            }
+        }
+
+        MT_LOG_FUNC auto fileSize(const int p_fd) -> uint64_t {
+            LARGE_INTEGER l_size;
+            if (not GetFileSizeEx(toHandle(p_fd), &l_size)) {
+                throw std::system_error(static_cast< int >(GetLastError()), std::system_category(), "JournalSink: GetFileSizeEx");
+            }
+            return static_cast< uint64_t >(l_size.QuadPart);
+        }
+
+        MT_LOG_FUNC auto openJournal(const std::filesystem::path& p_path, const bool p_read_only) -> int {
+            HANDLE l_file = CreateFileA(p_path.string().c_str(), p_read_only ? GENERIC_READ : (GENERIC_READ | GENERIC_WRITE), FILE_SHARE_READ, nullptr,
+                                        p_read_only ? OPEN_EXISTING : OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (l_file == INVALID_HANDLE_VALUE) {
+                throw std::system_error(static_cast< int >(GetLastError()), std::system_category(), "JournalSink: CreateFile");
+            }
+            return static_cast< int >(reinterpret_cast< intptr_t >(l_file));
+        }
+
+        MT_LOG_FUNC void closeJournal(const int p_fd) { CloseHandle(toHandle(p_fd)); }
+
+#endif
+
+        /**
+         * \internal
+         * \brief Walks the record chain from the journal header, handing each
+         * record whose length and checksum verify to [p_consume] (which may
+         * be null), and stops at the torn or unwritten tail. [p_end] is left
+         * at the append position.
+         */
+        MT_LOG_FUNC auto scanRecords(const int p_fd, const uint64_t p_file_size, const std::function< void(std::string_view) >* p_consume, uint64_t& p_end)
+            -> uint64_t {
+            uint64_t l_offset = header_size;
+            uint64_t l_count = 0;
+            std::string l_payload;
+            while (l_offset + record_header_size <= p_file_size) {
+                uint32_t l_header[2];
+                if (not readAt(p_fd, l_header, record_header_size, l_offset)) {
+                    break;
+                }
+                const auto l_length = l_header[0];
+                if (l_length == 0 or l_length > p_file_size - l_offset - record_header_size) {
+                    break;
+                }
+                l_payload.resize(l_length);
+                if (not readAt(p_fd, l_payload.data(), l_length, l_offset + record_header_size)) {
+                    break;
+                }
+                if (crc32(l_payload.data(), l_length) != l_header[1]) {
+                    break;
+                }
+                if (p_consume != nullptr) {
+                    (*p_consume)(std::string_view(l_payload));
+                }
+                l_offset += record_header_size + l_length;
+                ++l_count;
+            }
+            p_end = l_offset;
+            return l_count;
+        }
+
+    }  // namespace journal_detail
+
+    MT_LOG_FUNC JournalSink::JournalSink(std::filesystem::path p_path, JournalOptions p_options) :
+        m_path(std::move(p_path)),
+        m_options(p_options) {
+        if (m_options.journal_size < journal_detail::header_size + journal_detail::record_header_size) {
+            m_options.journal_size = journal_detail::header_size + journal_detail::record_header_size;
+        }
+        if (m_options.commit_records == 0) {
+            m_options.commit_records = 1;
+        }
+        m_fd = journal_detail::openJournal(m_path, false);
+        const auto l_existing = journal_detail::fileSize(m_fd);
+        char l_magic[sizeof(journal_detail::journal_magic)];
+        if (l_existing >= journal_detail::header_size and journal_detail::readAt(m_fd, l_magic, sizeof(l_magic), 0)
+            and std::memcmp(l_magic, journal_detail::journal_magic, sizeof(l_magic)) == 0) {
+            journal_detail::scanRecords(m_fd, l_existing, nullptr, m_cursor);
+        } else {
+            char l_header[journal_detail::header_size] = {};
+            std::memcpy(l_header, journal_detail::journal_magic, sizeof(journal_detail::journal_magic));
+            journal_detail::writeAt(m_fd, l_header, sizeof(l_header), l_header, 0, 0);
+            m_cursor = journal_detail::header_size;
+        }
+        m_allocated = l_existing > m_options.journal_size ? l_existing : m_options.journal_size;
+        preallocate(m_allocated);
+        m_committer = std::thread(&JournalSink::committerLoop, this);
+    }
+
+    MT_LOG_FUNC JournalSink::~JournalSink() {
+        {
+            std::scoped_lock lock(m_mutex);
+            m_stop = true;
+        }
+        m_committer_wakeup.notify_all();
+        if (m_committer.joinable()) {
+            m_committer.join();
+        }
+        if (m_fd >= 0) {
+            journal_detail::closeJournal(m_fd);
+            m_fd = -1;
+        }
+    }
+
+    MT_LOG_FUNC void JournalSink::preallocate(const uint64_t p_up_to) { journal_detail::growTo(m_fd, p_up_to); }
+
+    MT_LOG_FUNC void JournalSink::write(const std::string_view p_message, const bool p_durable) {
+        std::unique_lock lock(m_mutex);
+        const auto l_record_size = journal_detail::record_header_size + p_message.size();
+        if (m_cursor + l_record_size > m_allocated) {
+            const auto l_needed = m_cursor + l_record_size;
+            m_allocated += m_options.journal_size;
+            if (m_allocated < l_needed) {
+                m_allocated = l_needed;
+            }
+            preallocate(m_allocated);
+        }
+        const uint32_t l_header[2] = {static_cast< uint32_t >(p_message.size()), journal_detail::crc32(p_message.data(), p_message.size())};
+        journal_detail::writeAt(m_fd, l_header, sizeof(l_header), p_message.data(), p_message.size(), m_cursor);
+        m_cursor += l_record_size;
+        const auto l_sequence = ++m_appended;
+        if (p_durable) {
+            m_commit_requested = true;
+            m_committer_wakeup.notify_one();
+            m_commit_done.wait(lock, [this, l_sequence]() -> bool { return m_committed >= l_sequence or m_stop; });
+        } else if (m_appended - m_committed >= m_options.commit_records) {
+            m_committer_wakeup.notify_one();
+        }
+    }
+
+    MT_LOG_FUNC void JournalSink::flush() {
+        std::unique_lock lock(m_mutex);
+        const auto l_sequence = m_appended;
+        if (m_committed >= l_sequence) {
+            return;
+        }
+        m_commit_requested = true;
+        m_committer_wakeup.notify_one();
+        m_commit_done.wait(lock, [this, l_sequence]() -> bool { return m_committed >= l_sequence or m_stop; });
+    }
+
+    MT_LOG_FUNC void JournalSink::commitLocked(std::unique_lock< std::mutex >& p_lock) {
+        const auto l_up_to = m_appended;
+        p_lock.unlock();
+        journal_detail::syncData(m_fd);
+        p_lock.lock();
+        m_committed = l_up_to;
+        m_committed_visible.store(l_up_to, std::memory_order_relaxed);
+        m_commit_count.fetch_add(1, std::memory_order_relaxed);
+        m_commit_requested = false;
+        m_commit_done.notify_all();
+    }
+
+    MT_LOG_FUNC void JournalSink::committerLoop() {
+        std::unique_lock lock(m_mutex);
+        while (true) {
+            m_committer_wakeup.wait_for(lock, m_options.commit_interval, [this]() -> bool {
+                return m_stop or m_commit_requested or m_appended - m_committed >= m_options.commit_records;
+            });
+            if (m_appended > m_committed) {
+                commitLocked(lock);
+            }
+            if (m_stop and m_appended == m_committed) {
+                m_commit_done.notify_all();
+                return;
+            }
+        }
+    }
+
+    MT_LOG_FUNC auto JournalSink::recover(const std::filesystem::path& p_path, const std::function< void(std::string_view) >& p_consume) -> uint64_t {
+        const auto l_fd = journal_detail::openJournal(p_path, true);
+        uint64_t l_end = 0;
+        uint64_t l_count = 0;
+        try {
+            const auto l_size = journal_detail::fileSize(l_fd);
+            char l_magic[sizeof(journal_detail::journal_magic)];
+            if (l_size >= journal_detail::header_size and journal_detail::readAt(l_fd, l_magic, sizeof(l_magic), 0)
+                and std::memcmp(l_magic, journal_detail::journal_magic, sizeof(l_magic)) == 0) {
+                l_count = journal_detail::scanRecords(l_fd, l_size, &p_consume, l_end);
+            }
+        } catch (...) {
+            journal_detail::closeJournal(l_fd);
+            throw;
+        }
+        journal_detail::closeJournal(l_fd);
+        return l_count;
+    }
+
+}  // namespace mt::log
+
+#endif  // MT_JOURNAL_SINK_IPP
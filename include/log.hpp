@@ -1,9 +1,16 @@
 #ifndef MT_LOG_HPP
 #define MT_LOG_HPP
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstring>
 #include <mutex>
 #include <filesystem>
 #include <functional>
+#include <map>
+#include <memory>
 #include <ostream>
 #include <fstream>
 #include <iostream>
@@ -13,10 +20,185 @@
 #include <vector>
 #include <source_location>
 
+#include "binary_format.hpp"
+#include "clock_policy.hpp"
+#include "event_queue.hpp"
+#include "file_sink.hpp"
+#include "flight_recorder.hpp"
+#include "intern_table.hpp"
+#include "journal_sink.hpp"
+#include "message_buffer.hpp"
+#include "mmap_file_sink.hpp"
+#include "mpsc_ring.hpp"
+#include "network_sink.hpp"
+#include "sanitize.hpp"
+#include "shm_channel.hpp"
+
 namespace mt::log {
 
     auto processID() -> uint64_t;
 
+    /**
+     * \brief Writes a minimal crash record — pid, wall-clock timestamp,
+     * FATAL marker and the message — to the raw descriptor [p_fd].
+     *
+     * Safe to call from signal and terminate handlers: the record is built in
+     * a fixed stack buffer with hand-rolled decimal conversion and emitted
+     * with a single ::write(); no allocation, no locks, no exceptions, and
+     * only async-signal-safe calls (clock_gettime, getpid, write). Messages
+     * longer than the buffer are truncated.
+     *
+     * \param p_fd int - a pre-opened descriptor; opening files inside a
+     * signal handler is exactly what this path avoids.
+     * \param p_message std::string_view
+     */
+    void writeCrashRecord(int p_fd, std::string_view p_message) noexcept;
+
+    /**
+     * \brief Appends the decimal representation of [p_value] to [p_out] via
+     * std::to_chars, avoiding the temporary std::to_string would allocate.
+     */
+    inline void appendUnsigned(std::string& p_out, const uint64_t p_value) {
+        char l_digits[20];
+        const auto l_result = std::to_chars(l_digits, l_digits + sizeof(l_digits), p_value);
+        p_out.append(l_digits, l_result.ptr);
+    }
+
+    /**
+     * \struct CachedThreadID
+     * \brief A thread's numeric id with its decimal form pre-rendered, so
+     * formatting a thread id is a bounded append instead of a trip through
+     * ostream machinery. Plain data; events copy it by value.
+     */
+    struct CachedThreadID {
+        uint64_t numeric{0};
+        uint8_t length{0};
+        char text[20]{};
+
+        [[nodiscard]] auto view() const -> std::string_view { return {text, length}; }
+    };
+
+    /**
+     * \brief The calling thread's cached id: a process-unique dense counter
+     * assigned and rendered to decimal once per thread, on the first event
+     * the thread logs.
+     */
+    inline auto cachedThreadID() -> const CachedThreadID& {
+        thread_local const CachedThreadID cached = []() -> CachedThreadID {
+            static std::atomic< uint64_t > next_id{1};
+            CachedThreadID l_id;
+            l_id.numeric = next_id.fetch_add(1, std::memory_order_relaxed);
+            const auto l_result = std::to_chars(l_id.text, l_id.text + sizeof(l_id.text), l_id.numeric);
+            l_id.length = static_cast< uint8_t >(l_result.ptr - l_id.text);
+            return l_id;
+        }();
+        return cached;
+    }
+
+    /**
+     * \brief Appends the textual form of [p_value] to [p_out].
+     *
+     * Used by the deferred-formatting write() front-end to render captured
+     * arguments on the sink thread: arithmetic types go through
+     * std::to_chars, booleans become "true"/"false", and anything
+     * convertible to std::string_view is appended as is.
+     */
+    template < class Value > void appendValue(std::string& p_out, const Value& p_value) {
+        if constexpr (std::is_same_v< Value, bool >) {
+            p_out += p_value ? "true" : "false";
+        } else if constexpr (std::is_same_v< Value, char >) {
+            p_out += p_value;
+        } else if constexpr (std::is_arithmetic_v< Value >) {
+            char l_buffer[32];
+            const auto l_result = std::to_chars(l_buffer, l_buffer + sizeof(l_buffer), p_value);
+            p_out.append(l_buffer, l_result.ptr);
+        } else if constexpr (std::is_convertible_v< Value, std::string_view >) {
+            p_out += std::string_view{p_value};
+        } else {
+            static_assert(std::is_arithmetic_v< Value >, "appendValue: unsupported argument type for deferred formatting");
+        }
+    }
+
+    /**
+     * \struct DeferredPayload
+     * \brief Trivially-copyable argument capture for the lazy write()
+     * overload; a hand-rolled cons list because std::tuple is not trivially
+     * copyable and the capture travels through the queues as raw bytes.
+     */
+    template < class... Values > struct DeferredPayload;
+
+    template <> struct DeferredPayload<> { };
+
+    template < class First, class... Rest > struct DeferredPayload< First, Rest... > {
+        First value;
+        DeferredPayload< Rest... > rest;
+    };
+
+    inline auto makeDeferredPayload() -> DeferredPayload<> { return {}; }
+
+    template < class First, class... Rest >
+    auto makeDeferredPayload(First&& p_first, Rest&&... p_rest) -> DeferredPayload< std::decay_t< First >, std::decay_t< Rest >... > {
+        return {std::forward< First >(p_first), makeDeferredPayload(std::forward< Rest >(p_rest)...)};
+    }
+
+    inline void renderPayload(std::string&, std::string_view, size_t&, const DeferredPayload<>&) { }
+
+    template < class First, class... Rest >
+    void renderPayload(std::string& p_out, const std::string_view p_format, size_t& p_position, const DeferredPayload< First, Rest... >& p_payload) {
+        const auto l_brace = p_format.find("{}", p_position);
+        if (l_brace != std::string_view::npos) {
+            p_out.append(p_format.substr(p_position, l_brace - p_position));
+            appendValue(p_out, p_payload.value);
+            p_position = l_brace + 2;
+        }
+        renderPayload(p_out, p_format, p_position, p_payload.rest);
+    }
+
+    /**
+     * \brief Renders a deferred format capture: each "{}" placeholder in
+     * [p_format] is replaced with the next captured argument.
+     *
+     * [p_payload] is the byte image of a DeferredPayload written by the lazy
+     * write() overload; it is copied into a properly aligned local before
+     * use.
+     */
+    template < class Payload > void renderDeferred(const void* p_payload, const std::string_view p_format, std::string& p_out) {
+        Payload l_arguments;
+        std::memcpy(&l_arguments, p_payload, sizeof(Payload));
+        size_t l_position = 0;
+        renderPayload(p_out, p_format, l_position, l_arguments);
+        p_out.append(p_format.substr(l_position));
+    }
+
+    /**
+     * \enum QueueKind
+     * \brief Hand-off structure used between write() callers and the writer
+     * thread in asynchronous mode.
+     *
+     * \li Mutex    - mutex-and-condition-variable bounded queue (EventQueue).
+     * \li LockFree - lock-free ring buffer (MpscRing); write() costs a few
+     * atomic operations regardless of producer contention.
+     * \li Sharded  - per-thread staging rings registered via attachThread();
+     * write() appends to the calling thread's own ring with no shared-state
+     * touch and the writer thread harvests all shards, merging by sequence
+     * number.
+     */
+    enum class QueueKind : uint8_t {
+        Mutex,
+        LockFree,
+        Sharded
+    };
+
+    /**
+     * \enum SinkStatus
+     * \brief Health of the output configured for a message type, queryable
+     * through Log::sinkStatus() when the non-throwing mode is enabled.
+     */
+    enum class SinkStatus : uint8_t {
+        Ok,
+        Failed
+    };
+
     /**
      * \enum MessageType
      * \brief List of supported message types
@@ -30,13 +212,74 @@ namespace mt::log {
         Fatal
     };
 
+    /**
+     * \brief Compile-time check whether [Level] survives the LOG_DISABLE_*
+     * configuration macros.
+     *
+     * Used by the templated Log::write\<Level\>() front-end and the MT_LOG_*
+     * convenience macros to remove disabled levels from the binary entirely
+     * instead of filtering them after the LogEvent has been constructed.
+     */
+    template < MessageType Level > consteval auto isMessageTypeEnabled() -> bool {
+#if defined(LOG_DISABLE_TRACE)
+        if (Level == MessageType::Trace) {
+            return false;
+        }
+#endif
+#if defined(LOG_DISABLE_DEBUG)
+        if (Level == MessageType::Debug) {
+            return false;
+        }
+#endif
+#if defined(LOG_DISABLE_ERROR)
+        if (Level == MessageType::Error) {
+            return false;
+        }
+#endif
+#if defined(LOG_DISABLE_WARNING)
+        if (Level == MessageType::Warning) {
+            return false;
+        }
+#endif
+#if defined(LOG_DISABLE_INFO)
+        if (Level == MessageType::Info) {
+            return false;
+        }
+#endif
+#if defined(LOG_DISABLE_FATAL)
+        if (Level == MessageType::Fatal) {
+            return false;
+        }
+#endif
+        return true;
+    }
+
+    /**
+     * \struct LogEvent
+     * \brief A single captured log message together with its source location.
+     *
+     * Construction is allocation-free for messages up to
+     * MessageBuffer::inline_capacity bytes: the message is copied into an
+     * inline buffer, [function_name] and [file_name] are stored as
+     * std::string_view (std::source_location hands out pointers to static
+     * storage) and [line] stays numeric until formatting.
+     *
+     * \attention When the source location is passed explicitly rather than via
+     * std::source_location, the [p_function_name] and [p_file_name] views must
+     * outlive the event; string literals and static storage are safe.
+     */
     struct LogEvent {
-        LogEvent(std::string p_message, MessageType p_message_type, std::string p_function_name, std::string p_file_name, uint32_t p_line);
-        LogEvent(std::string p_message, MessageType p_message_type, std::source_location p_source_location);
-        LogEvent(std::string_view p_message, MessageType p_message_type, std::string p_function_name, std::string p_file_name, uint32_t p_line);
+        LogEvent(std::string_view p_message, MessageType p_message_type, std::string_view p_function_name, std::string_view p_file_name, uint32_t p_line,
+                 std::chrono::system_clock::time_point p_time_point = std::chrono::system_clock::now());
         LogEvent(std::string_view p_message, MessageType p_message_type, std::source_location p_source_location);
-        LogEvent(const char* p_message, MessageType p_message_type, std::string p_function_name, std::string p_file_name, uint32_t p_line);
-        LogEvent(const char* p_message, MessageType p_message_type, std::source_location p_source_location);
+
+        /**
+         * \brief As above, but stamped with [p_time_point] instead of
+         * system_clock::now(); used by Log when a non-default ClockPolicy is
+         * selected, so the default clock is never read on top of it.
+         */
+        LogEvent(std::string_view p_message, MessageType p_message_type, std::source_location p_source_location,
+                 std::chrono::system_clock::time_point p_time_point);
 
         LogEvent(const LogEvent& other) = delete;
         LogEvent(LogEvent&& other) = default;
@@ -48,16 +291,237 @@ namespace mt::log {
 
         [[nodiscard]] auto toString(const std::function< std::string(const LogEvent&) >& formatter = {}) const -> std::string;
 
+        /**
+         * \brief Appends the formatted representation to [p_out] without
+         * intermediate temporaries.
+         *
+         * Numeric fields are rendered with std::to_chars. Passing a reusable
+         * (e.g. thread-local) buffer makes formatting allocation-free once the
+         * buffer has grown to a typical line length; Log::write() does exactly
+         * that internally.
+         *
+         * \param p_out std::string&
+         * \param formatter const std::function\<std::string(const LogEvent&)\>&
+         */
+        void toString(std::string& p_out, const std::function< std::string(const LogEvent&) >& formatter = {}) const;
+
+        /**
+         * \brief Appends the message text to [p_out], rendering a deferred
+         * format capture (see the lazy Log::write() overload) on the fly.
+         * Custom formatters should use this instead of reading [message]
+         * directly, which holds raw argument bytes for deferred events.
+         * \param p_out std::string&
+         */
+        void appendMessage(std::string& p_out) const {
+            if (deferred_render == nullptr) {
+                if (sanitize) {
+                    sanitizeAppend(p_out, message.view());
+                } else {
+                    p_out += message.view();
+                }
+                return;
+            }
+            if (sanitize) {
+                std::string l_rendered;
+                deferred_render(message.view().data(), format, l_rendered);
+                sanitizeAppend(p_out, l_rendered);
+            } else {
+                deferred_render(message.view().data(), format, p_out);
+            }
+        }
+
+        /**
+         * \brief Returns the message text as a string; see appendMessage().
+         */
+        [[nodiscard]] auto messageText() const -> std::string {
+            std::string l_text;
+            appendMessage(l_text);
+            return l_text;
+        }
+
         std::chrono::time_point< std::chrono::system_clock > time_point;
-        std::string message_type_string;
-        std::string module_name;
-        std::string message;
-        std::string function_name;
-        std::string file_name;
-        std::string line;
-        std::thread::id thread_id;
+
+        /**
+         * \brief Per-Log-instance monotonic sequence number, assigned by
+         * write() before the event is queued. Usable by formatters and the
+         * binary format for ordering and gap detection.
+         */
+        uint64_t sequence{0};
+        std::string_view message_type_string;
+        std::string_view module_name;
+        MessageBuffer message;
+        std::string_view function_name;
+        std::string_view file_name;
+
+        /**
+         * \brief InternTable ids of [file_name] and [function_name]; nonzero
+         * only when the strings came from std::source_location static storage.
+         * The binary format keys its per-sink string table on these instead of
+         * hashing the full strings.
+         */
+        uint32_t file_id{0};
+        uint32_t function_id{0};
+        uint32_t line;
+
+        /**
+         * \brief The producing thread's cached numeric id with its decimal
+         * form pre-rendered; see cachedThreadID().
+         */
+        CachedThreadID thread_id;
 
         MessageType message_type;
+
+        /**
+         * \brief Deferred-formatting capture: when [deferred_render] is set,
+         * [message] holds the byte image of the captured argument tuple and
+         * [format] points at the "{}" format string (a literal, so static
+         * storage). Rendering happens on the sink thread, or never if the
+         * event is filtered before reaching a sink.
+         */
+        const char* format{nullptr};
+        void (*deferred_render)(const void* p_payload, std::string_view p_format, std::string& p_out){nullptr};
+
+        /**
+         * \brief When set (by Log when sanitization is enabled), the message
+         * is escaped to a single line while formatting; see sanitize.hpp.
+         */
+        bool sanitize{false};
+    };
+
+    /**
+     * \struct FormatWithLocation
+     * \brief Implicit wrapper pairing a format string with the call site, so
+     * the variadic lazy write() overload can still default its
+     * std::source_location.
+     */
+    struct FormatWithLocation {
+        FormatWithLocation(const char* p_format, const std::source_location p_location = std::source_location::current()) :  // NOLINT(*-explicit-constructor)
+            format(p_format),
+            location(p_location) { }
+
+        const char* format;
+        std::source_location location;
+    };
+
+    /**
+     * \brief Appends the default "YYYY-MM-DDThh:mm:ss.mmm" timestamp for
+     * [p_time_point] to [p_out], reusing the per-second cached prefix so only
+     * the milliseconds are rendered per message.
+     */
+    void appendDefaultTimestamp(std::string& p_out, std::chrono::system_clock::time_point p_time_point);
+
+    /**
+     * \brief Fields a compile-time layout can place; see StaticLayout.
+     */
+    enum class LayoutField : uint8_t { Timestamp, Level, Module, Message, Function, File, Line, ThreadID };
+
+    /**
+     * \struct StaticLayout
+     * \brief Compile-time format description: the field order is the
+     * template parameter pack, the separator a constexpr string.
+     *
+     * Because the layout is known at compile time the formatter compiles to
+     * a straight-line sequence of appends — no per-message parsing of a
+     * format string — and the output buffer is grown once up front from a
+     * per-event size estimate, so a typical line costs no reallocation.
+     * Usable directly as the StaticFormatter template parameter of Log:
+     *
+     * \code
+     * using TerseLayout = StaticLayout< LayoutField::Timestamp, LayoutField::Level, LayoutField::Message >;
+     * Log< std::mutex, std::mutex, TerseLayout > log;
+     * \endcode
+     */
+    template < LayoutField... Fields >
+    struct StaticLayout {
+        static constexpr std::string_view separator = " | ";
+
+        /**
+         * \brief Appends the formatted event to [p_out], separator between
+         * fields, newline at the end.
+         */
+        static void format(const LogEvent& p_log_event, std::string& p_out) {
+            p_out.reserve(p_out.size() + estimatedSize(p_log_event));
+            size_t l_index = 0;
+            (((l_index++ != 0 ? p_out += separator : p_out), appendField< Fields >(p_log_event, p_out)), ...);
+            p_out += '\n';
+        }
+
+        void operator()(const LogEvent& p_log_event, std::string& p_out) const { format(p_log_event, p_out); }
+
+    private:
+        /**
+         * \internal
+         * \brief Upper-bound line length: the separator and fixed-width
+         * field costs fold to a compile-time constant, leaving only the
+         * string field sizes to sum at runtime.
+         */
+        static auto estimatedSize(const LogEvent& p_log_event) -> size_t {
+            constexpr size_t fixed = (sizeof...(Fields) > 0 ? (sizeof...(Fields) - 1) * separator.size() : 0) + 1;
+            return fixed + (fieldEstimate< Fields >(p_log_event) + ... + 0);
+        }
+
+        template < LayoutField Field > static auto fieldEstimate(const LogEvent& p_log_event) -> size_t {
+            if constexpr (Field == LayoutField::Timestamp) {
+                return 23;
+            } else if constexpr (Field == LayoutField::Level) {
+                return 7;
+            } else if constexpr (Field == LayoutField::Module) {
+                return p_log_event.module_name.size();
+            } else if constexpr (Field == LayoutField::Message) {
+                return p_log_event.message.view().size();
+            } else if constexpr (Field == LayoutField::Function) {
+                return p_log_event.function_name.size();
+            } else if constexpr (Field == LayoutField::File) {
+                return p_log_event.file_name.size();
+            } else if constexpr (Field == LayoutField::ThreadID) {
+                return p_log_event.thread_id.length;
+            } else {
+                return 10;
+            }
+        }
+
+        template < LayoutField Field > static void appendField(const LogEvent& p_log_event, std::string& p_out) {
+            if constexpr (Field == LayoutField::Timestamp) {
+                appendDefaultTimestamp(p_out, p_log_event.time_point);
+            } else if constexpr (Field == LayoutField::Level) {
+                p_out += p_log_event.message_type_string;
+            } else if constexpr (Field == LayoutField::Module) {
+                p_out += p_log_event.module_name;
+            } else if constexpr (Field == LayoutField::Message) {
+                p_log_event.appendMessage(p_out);
+            } else if constexpr (Field == LayoutField::Function) {
+                p_out += p_log_event.function_name;
+            } else if constexpr (Field == LayoutField::File) {
+                p_out += p_log_event.file_name;
+            } else if constexpr (Field == LayoutField::ThreadID) {
+                p_out += p_log_event.thread_id.view();
+            } else {
+                appendUnsigned(p_out, p_log_event.line);
+            }
+        }
+    };
+
+    /**
+     * \brief The default pipe-delimited layout as a compile-time
+     * description; LogEvent::toString() and DefaultFormatter both compile
+     * down to this field sequence.
+     */
+    using DefaultLayout = StaticLayout< LayoutField::Timestamp, LayoutField::Level, LayoutField::Module, LayoutField::Message, LayoutField::Function,
+                                        LayoutField::File, LayoutField::Line >;
+
+    /**
+     * \struct DefaultFormatter
+     * \brief Stateless compile-time formatter policy producing the default
+     * pipe-delimited layout.
+     *
+     * Used as the StaticFormatter template parameter of Log. A custom policy
+     * is any stateless callable with the same signature — a StaticLayout
+     * instantiation, or any hand-written equivalent; because the call is
+     * resolved at compile time it inlines into write() with no type-erased
+     * dispatch and no std::function storage.
+     */
+    struct DefaultFormatter {
+        void operator()(const LogEvent& p_log_event, std::string& p_out) const { DefaultLayout::format(p_log_event, p_out); }
     };
 
     /**
@@ -72,6 +536,22 @@ namespace mt::log {
      * functions respectively. Output may be one of the following:
      * \li std::ostream*
      * \li const std::filesystem::path&
+     * \li std::shared_ptr\<FileSink\> - keeps the file handle open and buffers
+     * writes according to a FlushPolicy; preferable to the plain path output
+     * for high message rates.
+     * \li std::shared_ptr\<BinarySink\> - serializes events into the compact
+     * binary record format instead of text; render offline with the
+     * log_textualize tool.
+     * \li std::shared_ptr\<MmapFileSink\> - appends into a memory-mapped
+     * preallocated segment with size-based rotation; zero write() syscalls in
+     * steady state.
+     * \li std::shared_ptr\<NetworkSink\> - batches lines into frames and
+     * ships them to a remote collector on a background sender thread with
+     * reconnect and backoff; write() never blocks on the network.
+     * \li std::shared_ptr\<JournalSink\> - write-ahead journal with
+     * checksummed records and group-commit fsync for audit trails that must
+     * survive power loss; see setDurableWrites for per-type blocking
+     * durability.
      * \li std::function\<void(const std::string&)\>
      * \li std::weak_ptr<Class> and a pointer to a member function which accepts
      * const std::string& as a parameter. This should be considered as preferable
@@ -115,30 +595,50 @@ namespace mt::log {
      * LogEvent&& as parameter. This function should be used with caution as the validity
      * of pointer is not checked before function invocation.
      *
+     * \n A third way to customize formatting is the StaticFormatter template
+     * parameter: a stateless callable resolved at compile time which write()
+     * uses whenever no runtime formatter is installed for the message type,
+     * avoiding the std::function dispatch entirely for the common case.
+     *
      * \attention Write function is thread safe when output is set either to
      * std::ostream or to std::filesystem::path and not thread safe in case of user
      * defined callbacks. That is, it is a user obligation to handle multi-threaded
      * calls of provided callback function.
+     *
+     * \n A default-constructed Log performs no heap allocation: the per-type
+     * table and filters are fixed-size arrays, and everything dynamic (queues,
+     * threads, deduplication maps, runtime formatters) is allocated only when
+     * the corresponding feature is enabled. The default configuration is
+     * constant-initializable, so a namespace-scope instance may be declared
+     * constinit and used without static-initialization-order concerns. The
+     * log_header_only CMake target (which defines MT_LOG_HEADER_ONLY) further
+     * removes the library link for short-lived tools.
      */
-    template < class IPCMutex = std::mutex, class ThreadMutex = std::mutex > class Log {
+    template < class IPCMutex = std::mutex, class ThreadMutex = std::mutex, class StaticFormatter = DefaultFormatter,
+               class ClockPolicy = SystemClockPolicy >
+    class Log {
     public:
-        Log() {
-            m_message_types.emplace_back("TRACE");
-            m_message_types.emplace_back("DEBUG");
-            m_message_types.emplace_back("ERROR");
-            m_message_types.emplace_back("WARNING");
-            m_message_types.emplace_back("INFO");
-            m_message_types.emplace_back("FATAL");
+        /**
+         * \brief Number of values in MessageType.
+         */
+        static constexpr size_t message_type_count = 6;
 
-            m_outputs.emplace_back(&std::cout);
-            m_outputs.emplace_back(&std::cout);
-            m_outputs.emplace_back(&std::cout);
-            m_outputs.emplace_back(&std::cout);
-            m_outputs.emplace_back(&std::cout);
-            m_outputs.emplace_back(&std::cout);
+        /**
+         * \brief Maximum number of events the writer thread formats into one
+         * coalesced output buffer per drain pass.
+         */
+        static constexpr size_t drain_batch_size = 256;
 
-            m_formatters.resize(6);
-        }
+        /**
+         * \brief The set of destinations an output slot can hold; see the
+         * setOutput overloads for the semantics of each alternative.
+         */
+        using Output = std::variant< std::monostate, std::ostream*, std::filesystem::path, std::shared_ptr< FileSink >, std::shared_ptr< BinarySink >,
+                                     std::shared_ptr< MmapFileSink >, std::shared_ptr< ShmChannelProducer >, std::shared_ptr< FlightRecorderSink >,
+                                     std::shared_ptr< NetworkSink >, std::shared_ptr< JournalSink >,
+                                     std::function< void(const std::string&) > >;
+
+        Log() = default;
 
         explicit Log(IPCMutex& p_mutex_ref) :
             Log() {
@@ -177,14 +677,15 @@ namespace mt::log {
          * \param message_type MessageType
          * \param value const std::string&
          */
-        void setMessageTypeOutput(MessageType message_type, const std::string& value) { m_message_types.at(static_cast< size_t >(message_type)) = value; }
+        void setMessageTypeOutput(MessageType message_type, const std::string& value) { m_entries[static_cast< size_t >(message_type)].label = value; }
 
         /**
          * \brief Sets output for all message types.
          * \param output_stream std::ostream*
          */
         void setGlobalOutput(std::ostream* output_stream) {
-            for (auto& output: m_outputs) {
+            for (auto& l_entry: m_entries) {
+                auto& output = l_entry.output;
                 if (output_stream == nullptr) {
                     output = std::monostate();
                 } else {
@@ -199,18 +700,154 @@ namespace mt::log {
          * \param file const std::filesystem::path&
          */
         void setGlobalOutput(const std::filesystem::path& file) {
-            for (auto& output: m_outputs) {
+            for (auto& l_entry: m_entries) {
+                auto& output = l_entry.output;
                 output = file;
             }
         }
 
+        /**
+         * \overload
+         * \brief Sets output for all message types.
+         * \param file_sink std::shared_ptr\<FileSink\>
+         */
+        void setGlobalOutput(std::shared_ptr< FileSink > file_sink) {
+            for (auto& l_entry: m_entries) {
+                auto& output = l_entry.output;
+                if (file_sink == nullptr) {
+                    output = std::monostate();
+                } else {
+                    output = file_sink;
+                }
+            }
+        }
+
+        /**
+         * \overload
+         * \brief Sets output for all message types.
+         * \param mmap_sink std::shared_ptr\<MmapFileSink\>
+         */
+        void setGlobalOutput(std::shared_ptr< MmapFileSink > mmap_sink) {
+            for (auto& l_entry: m_entries) {
+                auto& output = l_entry.output;
+                if (mmap_sink == nullptr) {
+                    output = std::monostate();
+                } else {
+                    output = mmap_sink;
+                }
+            }
+        }
+
+        /**
+         * \overload
+         * \brief Sets output for all message types.
+         * \param binary_sink std::shared_ptr\<BinarySink\>
+         */
+        void setGlobalOutput(std::shared_ptr< BinarySink > binary_sink) {
+            for (auto& l_entry: m_entries) {
+                auto& output = l_entry.output;
+                if (binary_sink == nullptr) {
+                    output = std::monostate();
+                } else {
+                    output = binary_sink;
+                }
+            }
+        }
+
+        /**
+         * \overload
+         * \brief Sets output for all message types.
+         *
+         * Messages are appended to this process's ring in the shared-memory
+         * channel; a ShmChannelCollector in the owner process merges the
+         * rings of all participating processes and writes the file, replacing
+         * the cross-process IPCMutex lock around every write.
+         *
+         * \param shm_producer std::shared_ptr\<ShmChannelProducer\>
+         */
+        void setGlobalOutput(std::shared_ptr< ShmChannelProducer > shm_producer) {
+            for (auto& l_entry: m_entries) {
+                auto& output = l_entry.output;
+                if (shm_producer == nullptr) {
+                    output = std::monostate();
+                } else {
+                    output = shm_producer;
+                }
+            }
+        }
+
+        /**
+         * \overload
+         * \brief Sets output for all message types.
+         *
+         * Formatted lines are batched into frames and shipped to the remote
+         * collector by the sink's own sender thread; write() never blocks on
+         * the network. See NetworkSink.
+         *
+         * \param network_sink std::shared_ptr\<NetworkSink\>
+         */
+        void setGlobalOutput(std::shared_ptr< NetworkSink > network_sink) {
+            for (auto& l_entry: m_entries) {
+                auto& output = l_entry.output;
+                if (network_sink == nullptr) {
+                    output = std::monostate();
+                } else {
+                    output = network_sink;
+                }
+            }
+        }
+
+        /**
+         * \overload
+         * \brief Sets output for all message types.
+         *
+         * Lines are appended to the write-ahead journal as checksummed
+         * records and made durable by group-commit fsync; Fatal messages and
+         * types marked via setDurableWrites block until their record is on
+         * the device. See JournalSink.
+         *
+         * \param journal_sink std::shared_ptr\<JournalSink\>
+         */
+        void setGlobalOutput(std::shared_ptr< JournalSink > journal_sink) {
+            for (auto& l_entry: m_entries) {
+                auto& output = l_entry.output;
+                if (journal_sink == nullptr) {
+                    output = std::monostate();
+                } else {
+                    output = journal_sink;
+                }
+            }
+        }
+
+        /**
+         * \overload
+         * \brief Sets output for all message types.
+         *
+         * Events are retained in the recorder's in-memory ring in binary
+         * form and only formatted when the history is dumped; see
+         * FlightRecorderSink.
+         *
+         * \param flight_recorder std::shared_ptr\<FlightRecorderSink\>
+         */
+        void setGlobalOutput(std::shared_ptr< FlightRecorderSink > flight_recorder) {
+            for (auto& l_entry: m_entries) {
+                auto& output = l_entry.output;
+                if (flight_recorder == nullptr) {
+                    output = std::monostate();
+                } else {
+                    output = flight_recorder;
+                }
+            }
+        }
+
         /**
          * \overload
          * \brief Sets output for all message types.
          * \param output_func std::function\<void(const std::string&)\>&&
          */
         void setGlobalOutput(std::function< void(const std::string&) >&& output_func) {
-            for (auto& l_output: m_outputs) {
+            for (auto& l_entry: m_entries) {
+                auto& l_output = l_entry.output;
                 if (output_func == nullptr) {
                     l_output = std::monostate();
                 } else {
@@ -227,7 +864,8 @@ namespace mt::log {
          * void (Object::*functor)(const std::string&)
          */
         template < class Object > void setGlobalOutput(std::weak_ptr< Object > object, void (Object::*functor)(const std::string&)) {
-            for (auto& output: m_outputs) {
+            for (auto& l_entry: m_entries) {
+                auto& output = l_entry.output;
                 output = [object, functor](const std::string& message) {
                     if (auto l_object = object.lock()) {
                         std::invoke(functor, l_object, message);
@@ -244,7 +882,8 @@ namespace mt::log {
          * (Object::*functor)(const std::string&)
          */
         template < class Object > void setGlobalOutput(Object* object, void (Object::*functor)(const std::string&)) {
-            for (auto& output: m_outputs) {
+            for (auto& l_entry: m_entries) {
+                auto& output = l_entry.output;
                 output = [object, functor](const std::string& message) {
                     std::invoke(functor, object, message);
                 };
@@ -258,9 +897,9 @@ namespace mt::log {
          */
         void setOutput(MessageType message_type, std::ostream* output_stream) {
             if (output_stream == nullptr) {
-                m_outputs.at(static_cast< size_t >(message_type)) = std::monostate();
+                m_entries[static_cast< size_t >(message_type)].output = std::monostate();
             } else {
-                m_outputs.at(static_cast< size_t >(message_type)) = output_stream;
+                m_entries[static_cast< size_t >(message_type)].output = output_stream;
             }
         }
 
@@ -271,47 +910,187 @@ namespace mt::log {
          * \param file const std::filesystem::path&
          */
 
-        void setOutput(MessageType message_type, const std::filesystem::path& file) { m_outputs.at(static_cast< size_t >(message_type)) = file; }
+        void setOutput(MessageType message_type, const std::filesystem::path& file) { m_entries[static_cast< size_t >(message_type)].output = file; }
 
         /**
          * \overload
          * \brief Sets output for specified message type.
          * \param message_type MessageType
-         * \param output_func std::function\<void(const std::string&)\>&&
+         * \param file_sink std::shared_ptr\<FileSink\>
          */
-        void setOutput(MessageType message_type, std::function< void(const std::string&) >&& output_func) {
-            if (output_func == nullptr) {
-                m_outputs.at(static_cast< size_t >(message_type)) = std::monostate();
+        void setOutput(MessageType message_type, std::shared_ptr< FileSink > file_sink) {
+            if (file_sink == nullptr) {
+                m_entries[static_cast< size_t >(message_type)].output = std::monostate();
             } else {
-                m_outputs.at(static_cast< size_t >(message_type)) = output_func;
+                m_entries[static_cast< size_t >(message_type)].output = std::move(file_sink);
             }
         }
 
         /**
          * \overload
          * \brief Sets output for specified message type.
-         * \tparam Object class which implements the function pointer passed as a second parameter
          * \param message_type MessageType
-         * \param object std::shared_ptr\<Object\>
-         * \param functor void (Object::*functor)(const std::string&)
+         * \param mmap_sink std::shared_ptr\<MmapFileSink\>
          */
-        template < class Object > void setOutput(MessageType message_type, std::weak_ptr< Object > object, void (Object::*functor)(const std::string&)) {
-            m_outputs.at(static_cast< size_t >(message_type)) = [object, functor](const std::string& message) {
-                if (auto l_object = object.lock()) {
-                    std::invoke(functor, l_object, message);
-                }
-            };
+        void setOutput(MessageType message_type, std::shared_ptr< MmapFileSink > mmap_sink) {
+            if (mmap_sink == nullptr) {
+                m_entries[static_cast< size_t >(message_type)].output = std::monostate();
+            } else {
+                m_entries[static_cast< size_t >(message_type)].output = std::move(mmap_sink);
+            }
         }
 
         /**
          * \overload
          * \brief Sets output for specified message type.
-         * \tparam Object class which implements the function pointer passed as a second parameter
-         * \param message_type MessageType \param object Object*
+         * \param message_type MessageType
+         * \param binary_sink std::shared_ptr\<BinarySink\>
+         */
+        void setOutput(MessageType message_type, std::shared_ptr< BinarySink > binary_sink) {
+            if (binary_sink == nullptr) {
+                m_entries[static_cast< size_t >(message_type)].output = std::monostate();
+            } else {
+                m_entries[static_cast< size_t >(message_type)].output = std::move(binary_sink);
+            }
+        }
+
+        /**
+         * \overload
+         * \brief Sets output for specified message type.
+         * \param message_type MessageType
+         * \param shm_producer std::shared_ptr\<ShmChannelProducer\>
+         */
+        void setOutput(MessageType message_type, std::shared_ptr< ShmChannelProducer > shm_producer) {
+            auto& output = m_entries[static_cast< size_t >(message_type)].output;
+            if (shm_producer == nullptr) {
+                output = std::monostate();
+            } else {
+                output = shm_producer;
+            }
+        }
+
+        /**
+         * \overload
+         * \brief Sets output for specified message type.
+         * \param message_type MessageType
+         * \param network_sink std::shared_ptr\<NetworkSink\>
+         */
+        void setOutput(MessageType message_type, std::shared_ptr< NetworkSink > network_sink) {
+            auto& output = m_entries[static_cast< size_t >(message_type)].output;
+            if (network_sink == nullptr) {
+                output = std::monostate();
+            } else {
+                output = network_sink;
+            }
+        }
+
+        /**
+         * \overload
+         * \brief Sets output for specified message type.
+         * \param message_type MessageType
+         * \param journal_sink std::shared_ptr\<JournalSink\>
+         */
+        void setOutput(MessageType message_type, std::shared_ptr< JournalSink > journal_sink) {
+            auto& output = m_entries[static_cast< size_t >(message_type)].output;
+            if (journal_sink == nullptr) {
+                output = std::monostate();
+            } else {
+                output = journal_sink;
+            }
+        }
+
+        /**
+         * \overload
+         * \brief Sets output for specified message type.
+         * \param message_type MessageType
+         * \param flight_recorder std::shared_ptr\<FlightRecorderSink\>
+         */
+        void setOutput(MessageType message_type, std::shared_ptr< FlightRecorderSink > flight_recorder) {
+            auto& output = m_entries[static_cast< size_t >(message_type)].output;
+            if (flight_recorder == nullptr) {
+                output = std::monostate();
+            } else {
+                output = flight_recorder;
+            }
+        }
+
+        /**
+         * \brief Adds a secondary output for [message_type].
+         *
+         * Unlike setOutput, which replaces the destination, addOutput fans
+         * the formatted line out to an additional sink with its own bounded
+         * queue, drain thread and overflow policy — a slow or blocked sink
+         * (say, a network shipper) sheds load per its policy without adding
+         * latency to the primary output or to other secondaries. The
+         * formatted buffer is shared refcounted across all sinks of the
+         * event, never re-formatted.
+         *
+         * Supported destinations: std::ostream*, FileSink, MmapFileSink,
+         * ShmChannelProducer, NetworkSink and callbacks. Event-consuming sinks (binary,
+         * flight recorder) and plain paths are ignored here.
+         *
+         * \param message_type MessageType
+         * \param output Output
+         * \param p_queue_capacity size_t
+         * \param p_overflow_policy OverflowPolicy
+         */
+        void addOutput(MessageType message_type, Output output, const size_t p_queue_capacity = 1024,
+                       const OverflowPolicy p_overflow_policy = OverflowPolicy::DropNewest) {
+            m_entries[static_cast< size_t >(message_type)].extras.push_back(
+                std::make_shared< FanOutSink >(std::move(output), p_queue_capacity, p_overflow_policy));
+        }
+
+        /**
+         * \overload
+         * \brief Adds a secondary output for all message types, sharing one
+         * queue and drain thread across them.
+         */
+        void addGlobalOutput(Output output, const size_t p_queue_capacity = 1024, const OverflowPolicy p_overflow_policy = OverflowPolicy::DropNewest) {
+            auto l_sink = std::make_shared< FanOutSink >(std::move(output), p_queue_capacity, p_overflow_policy);
+            for (auto& l_entry: m_entries) {
+                l_entry.extras.push_back(l_sink);
+            }
+        }
+
+        /**
+         * \overload
+         * \brief Sets output for specified message type.
+         * \param message_type MessageType
+         * \param output_func std::function\<void(const std::string&)\>&&
+         */
+        void setOutput(MessageType message_type, std::function< void(const std::string&) >&& output_func) {
+            if (output_func == nullptr) {
+                m_entries[static_cast< size_t >(message_type)].output = std::monostate();
+            } else {
+                m_entries[static_cast< size_t >(message_type)].output = output_func;
+            }
+        }
+
+        /**
+         * \overload
+         * \brief Sets output for specified message type.
+         * \tparam Object class which implements the function pointer passed as a second parameter
+         * \param message_type MessageType
+         * \param object std::shared_ptr\<Object\>
+         * \param functor void (Object::*functor)(const std::string&)
+         */
+        template < class Object > void setOutput(MessageType message_type, std::weak_ptr< Object > object, void (Object::*functor)(const std::string&)) {
+            m_entries[static_cast< size_t >(message_type)].output = [object, functor](const std::string& message) {
+                if (auto l_object = object.lock()) {
+                    std::invoke(functor, l_object, message);
+                }
+            };
+        }
+
+        /**
+         * \overload
+         * \brief Sets output for specified message type.
+         * \tparam Object class which implements the function pointer passed as a second parameter
+         * \param message_type MessageType \param object Object*
          * \param functor void (Object::*functor)(const std::string&)
          */
         template < class Object > void setOutput(MessageType message_type, Object* object, void (Object::*functor)(const std::string&)) {
-            m_outputs.at(static_cast< size_t >(message_type)) = [object, functor](const std::string& message) {
+            m_entries[static_cast< size_t >(message_type)].output = [object, functor](const std::string& message) {
                 std::invoke(functor, object, message);
             };
         }
@@ -321,25 +1100,584 @@ namespace mt::log {
          * \param formatter std::function\<std::string(LogEvent&&)\>
          */
         void setGlobalFormatter(std::function< std::string(const LogEvent& log_event) >&& formatter) {
-            for (auto& l_formatter: m_formatters) {
-                l_formatter = formatter;
+            const auto l_shared =
+                formatter == nullptr ? nullptr : std::make_shared< const std::function< std::string(const LogEvent&) > >(std::move(formatter));
+            for (auto& l_entry: m_entries) {
+                l_entry.formatter = l_shared;
             }
         }
 
         /**
-         * \brief Sets formatter for specified message type.
-         * \param message_type MessageType
-         * \param formatter std::function\<std::string(LogEvent&&)\>
+         * \brief Sets formatter for specified message type.
+         * \param message_type MessageType
+         * \param formatter std::function\<std::string(LogEvent&&)\>
+         */
+        void setFormatter(MessageType message_type, std::function< std::string(const LogEvent& log_event) >&& formatter) {
+            m_entries[static_cast< size_t >(message_type)].formatter =
+                formatter == nullptr ? nullptr : std::make_shared< const std::function< std::string(const LogEvent&) > >(std::move(formatter));
+        }
+
+        /**
+         * \brief Switches the instance to the non-throwing failure mode.
+         *
+         * By default a sink failure (e.g. the log file cannot be opened on a
+         * full disk) propagates out of write() as an exception. In the
+         * non-throwing mode the failure instead marks the sink as Failed,
+         * invokes the error callback once, and subsequent messages for that
+         * sink are diverted to stderr (or dropped when [p_fallback_to_stderr]
+         * is false) until clearSinkStatus() is called, so logging never
+         * unwinds latency-critical call sites.
+         *
+         * \param p_fallback_to_stderr bool
+         */
+        void enableNonThrowing(const bool p_fallback_to_stderr = true) {
+            m_fallback_to_stderr = p_fallback_to_stderr;
+            m_non_throwing = true;
+        }
+
+        /**
+         * \brief Enables the sanitization stage of the formatting path.
+         *
+         * Message bytes that would break single-line records — control
+         * characters, DEL and backslash — are escaped while the message is
+         * appended to the output line. The scan for unsafe bytes is
+         * vectorized, so clean messages (the common case) pay close to
+         * nothing; see sanitize.hpp.
+         *
+         * \param p_enabled bool
+         */
+        void enableSanitization(const bool p_enabled = true) { m_sanitize = p_enabled; }
+
+        /**
+         * \brief Sets a token-bucket rate limit for [message_type].
+         *
+         * Tokens refill at [p_per_second] with a burst allowance of
+         * [p_burst]; writes finding the bucket empty are rejected before the
+         * message string or the event is constructed, so a runaway loop
+         * costs a couple of atomic operations per suppressed message.
+         * Rejections are counted in Stats::filtered_events.
+         *
+         * \param message_type MessageType
+         * \param p_per_second double - zero removes the limit.
+         * \param p_burst double
+         */
+        void setRateLimit(MessageType message_type, const double p_per_second, const double p_burst = 0) {
+            auto& l_filter = m_filters[static_cast< size_t >(message_type)];
+            l_filter.rate_milli_per_ms = p_per_second;
+            l_filter.burst_milli = static_cast< uint32_t >((p_burst > 0 ? p_burst : (p_per_second > 1 ? p_per_second : 1)) * 1000);
+            l_filter.bucket_state.store((static_cast< uint64_t >(elapsedMilliseconds()) << 32) | l_filter.burst_milli, std::memory_order_relaxed);
+        }
+
+        /**
+         * \brief Keeps one in [p_keep_one_in] messages of [message_type] and
+         * rejects the rest before event construction.
+         * \param message_type MessageType
+         * \param p_keep_one_in uint32_t - zero or one disables sampling.
+         */
+        void setSampling(MessageType message_type, const uint32_t p_keep_one_in) {
+            m_filters[static_cast< size_t >(message_type)].keep_one_in = p_keep_one_in;
+        }
+
+        /**
+         * \brief Suppresses repeats of [message_type] messages from the same
+         * call site within [p_window].
+         *
+         * The first message from a file/line passes; identical call sites
+         * repeating inside the window are rejected and counted, and the next
+         * passing message from that site is preceded by a
+         * "suppressed N similar messages" summary.
+         *
+         * \param message_type MessageType
+         * \param p_window std::chrono::milliseconds - zero disables.
+         */
+        void setDuplicateSuppression(MessageType message_type, const std::chrono::milliseconds p_window) {
+            m_filters[static_cast< size_t >(message_type)].dedup_window = p_window;
+        }
+
+        /**
+         * \brief Makes writes of [message_type] block until their record is
+         * durable when the output is a JournalSink; other outputs ignore the
+         * flag. Fatal writes to a journal are always durable.
+         *
+         * Overlapping durable writers share one group commit, so marking
+         * Error durable costs one fsync per commit window, not one per
+         * message.
+         *
+         * \param message_type MessageType
+         * \param p_durable bool
+         */
+        void setDurableWrites(MessageType message_type, const bool p_durable = true) {
+            m_entries[static_cast< size_t >(message_type)].durable = p_durable;
+        }
+
+        /**
+         * \brief Enables crash mode: Fatal messages bypass the normal
+         * pipeline — its locks, allocations and throwing file opens — and go
+         * through writeFatalUnsafe() instead.
+         *
+         * Intended to be flipped on from a terminate or signal handler (the
+         * store is a relaxed atomic) before logging the final message.
+         * Deferred-format Fatal writes emit their format string verbatim in
+         * this mode, since rendering arguments would allocate.
+         *
+         * \param p_enabled bool
+         */
+        void enableCrashMode(const bool p_enabled = true) noexcept { m_crash_mode.store(p_enabled, std::memory_order_relaxed); }
+
+        /**
+         * \brief Sets the pre-opened descriptor the crash path writes to;
+         * stderr by default. Open it at startup, not in the handler.
+         * \param p_fd int
+         */
+        void setCrashOutput(const int p_fd) noexcept { m_crash_fd.store(p_fd, std::memory_order_relaxed); }
+
+        /**
+         * \brief Writes [p_message] as a crash record to the configured
+         * descriptor, using only async-signal-safe calls. Usable directly
+         * from a signal handler whether or not crash mode is enabled.
+         * \param p_message std::string_view
+         */
+        void writeFatalUnsafe(const std::string_view p_message) noexcept {
+            writeCrashRecord(m_crash_fd.load(std::memory_order_relaxed), p_message);
+        }
+
+        /**
+         * \brief Sets the callback invoked on the first failure of each sink
+         * in the non-throwing mode.
+         *
+         * The callback receives the message type whose sink failed and the
+         * failure description; it may run on the writer thread and must not
+         * log through this instance.
+         *
+         * \param p_callback std::function\<void(MessageType, const std::string&)\>
+         */
+        void setErrorCallback(std::function< void(MessageType message_type, const std::string& reason) >&& p_callback) {
+            m_error_callback = p_callback == nullptr
+                                 ? nullptr
+                                 : std::make_shared< const std::function< void(MessageType, const std::string&) > >(std::move(p_callback));
+        }
+
+        /**
+         * \brief Reports the sticky health state of the sink configured for
+         * [p_message_type].
+         * \param p_message_type MessageType
+         * \return SinkStatus
+         */
+        [[nodiscard]] auto sinkStatus(const MessageType p_message_type) const -> SinkStatus {
+            return m_entries[static_cast< size_t >(p_message_type)].failed.load(std::memory_order_acquire) ? SinkStatus::Failed : SinkStatus::Ok;
+        }
+
+        /**
+         * \brief Clears the sticky error state of the sink configured for
+         * [p_message_type], e.g. after the operator has freed disk space.
+         * \param p_message_type MessageType
+         */
+        void clearSinkStatus(const MessageType p_message_type) {
+            m_entries[static_cast< size_t >(p_message_type)].failed.store(false, std::memory_order_release);
+        }
+
+        /**
+         * \brief Switches the instance to asynchronous mode.
+         *
+         * In asynchronous mode write() only enqueues the LogEvent into a
+         * bounded in-process queue and returns; a dedicated background thread
+         * drains the queue, formats the events and performs the I/O. The
+         * reaction to a full queue is selected via [p_overflow_policy].
+         *
+         * Must be called before the first write() from another thread.
+         *
+         * \param p_queue_capacity size_t
+         * \param p_overflow_policy OverflowPolicy
+         * \param p_queue_kind QueueKind
+         */
+        void enableAsync(const size_t p_queue_capacity = 8192, const OverflowPolicy p_overflow_policy = OverflowPolicy::Block,
+                         const QueueKind p_queue_kind = QueueKind::Mutex) {
+            if (m_queue != nullptr or m_ring != nullptr or m_sharded.load(std::memory_order_acquire)) {
+                return;
+            }
+            if (p_queue_kind == QueueKind::Sharded) {
+                m_sharded.store(true, std::memory_order_release);
+                m_shard_capacity = p_queue_capacity;
+                m_writer_thread = std::make_unique< std::thread >([this]() -> void {
+                    std::vector< LogEvent > l_batch;
+                    while (true) {
+                        harvestShards(l_batch);
+                        if (l_batch.empty()) {
+                            m_harvester_busy.store(false, std::memory_order_release);
+                            if (m_ring_closed.load(std::memory_order_acquire)) {
+                                harvestShards(l_batch);
+                                if (l_batch.empty()) {
+                                    return;
+                                }
+                            } else {
+                                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                                continue;
+                            }
+                        }
+                        std::sort(l_batch.begin(), l_batch.end(), [](const LogEvent& p_left, const LogEvent& p_right) -> bool {
+                            return p_left.sequence < p_right.sequence;
+                        });
+                        writeBatch(l_batch);
+                        l_batch.clear();
+                    }
+                });
+                return;
+            }
+            if (p_queue_kind == QueueKind::LockFree) {
+                m_ring = std::make_unique< MpscRing< LogEvent > >(p_queue_capacity);
+                m_ring_policy = p_overflow_policy;
+                m_writer_thread = std::make_unique< std::thread >([this]() -> void {
+                    std::vector< LogEvent > l_batch;
+                    while (true) {
+                        while (l_batch.size() < drain_batch_size) {
+                            auto l_event = m_ring->tryPop();
+                            if (not l_event) {
+                                break;
+                            }
+                            l_batch.push_back(std::move(*l_event));
+                        }
+                        if (not l_batch.empty()) {
+                            writeBatch(l_batch);
+                            m_ring_written.fetch_add(l_batch.size(), std::memory_order_release);
+                            l_batch.clear();
+                            continue;
+                        }
+                        if (m_ring_closed.load(std::memory_order_acquire) and m_ring->empty()) {
+                            return;
+                        }
+                        std::this_thread::sleep_for(std::chrono::microseconds(50));
+                    }
+                });
+                return;
+            }
+            m_queue = std::make_unique< EventQueue< LogEvent > >(p_queue_capacity, p_overflow_policy);
+            m_writer_thread = std::make_unique< std::thread >([this]() -> void {
+                std::vector< LogEvent > l_batch;
+                while (m_queue->popBatch(l_batch)) {
+                    writeBatch(l_batch);
+                    l_batch.clear();
+                    m_queue->drainComplete();
+                }
+            });
+        }
+
+        /**
+         * \internal
+         * \brief A producer thread's staging buffer in sharded mode. The ring
+         * is written by exactly one thread and drained by the harvester.
+         */
+        struct Shard {
+            explicit Shard(const size_t p_capacity) :
+                ring(p_capacity) { }
+
+            MpscRing< LogEvent > ring;
+            std::atomic< bool > detached{false};
+        };
+
+        /**
+         * \class ShardHandle
+         * \brief RAII registration of the calling thread's staging buffer for
+         * QueueKind::Sharded. While the handle lives, write() calls from the
+         * owning thread append to a private ring; on destruction the shard is
+         * detached and dropped by the harvester once drained.
+         */
+        class ShardHandle {
+        public:
+            ShardHandle() = default;
+
+            ShardHandle(const ShardHandle&) = delete;
+            ShardHandle& operator=(const ShardHandle&) = delete;
+
+            ShardHandle(ShardHandle&& other) noexcept :
+                m_log(other.m_log),
+                m_shard(std::move(other.m_shard)) {
+                other.m_log = nullptr;
+            }
+
+            ShardHandle& operator=(ShardHandle&& other) noexcept {
+                if (this != &other) {
+                    release();
+                    m_log = other.m_log;
+                    m_shard = std::move(other.m_shard);
+                    other.m_log = nullptr;
+                }
+                return *this;
+            }
+
+            ~ShardHandle() { release(); }
+
+        private:
+            friend class Log;
+
+            ShardHandle(Log* p_log, std::shared_ptr< Shard > p_shard) :
+                m_log(p_log),
+                m_shard(std::move(p_shard)) { }
+
+            void release() {
+                if (m_log != nullptr) {
+                    auto& l_registry = threadShardRegistry();
+                    std::erase_if(l_registry, [this](const auto& p_entry) -> bool {
+                        return p_entry.first == m_log;
+                    });
+                    m_shard->detached.store(true, std::memory_order_release);
+                    m_log = nullptr;
+                    m_shard.reset();
+                }
+            }
+
+            Log* m_log{nullptr};
+            std::shared_ptr< Shard > m_shard;
+        };
+
+        /**
+         * \brief Registers a per-thread staging buffer for sharded mode.
+         *
+         * Must be called on each producer thread after enableAsync with
+         * QueueKind::Sharded; write() calls from a thread without a shard fall
+         * back to the synchronous path. The returned handle deregisters the
+         * shard when it goes out of scope.
+         *
+         * \return ShardHandle
+         */
+        [[nodiscard]] auto attachThread() -> ShardHandle {
+            auto l_shard = std::make_shared< Shard >(m_shard_capacity);
+            {
+                std::scoped_lock lock(m_shards_mutex);
+                m_shards.push_back(l_shard);
+            }
+            threadShardRegistry().emplace_back(this, l_shard.get());
+            return {this, std::move(l_shard)};
+        }
+
+        /**
+         * \brief Blocks until every event enqueued so far has been written and
+         * pushes any buffered FileSink output to disk.
+         */
+        void flush() {
+            m_flush_count.value.fetch_add(1, std::memory_order_relaxed);
+            flushSuppressed();
+            if (m_queue != nullptr) {
+                m_queue->waitUntilEmpty();
+            }
+            if (m_ring != nullptr) {
+                const auto l_pushed = m_ring_pushed.load(std::memory_order_acquire);
+                while (m_ring_written.load(std::memory_order_acquire) < l_pushed) {
+                    std::this_thread::yield();
+                }
+            }
+            if (m_sharded.load(std::memory_order_acquire)) {
+                while (shardsPending() or m_harvester_busy.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+            }
+            std::scoped_lock lock(m_mutex);
+            for (auto& l_entry: m_entries) {
+                auto& output = l_entry.output;
+                if (auto* l_sink = std::get_if< std::shared_ptr< FileSink > >(&output)) {
+                    (*l_sink)->flush();
+                }
+                if (auto* l_binary_sink = std::get_if< std::shared_ptr< BinarySink > >(&output)) {
+                    (*l_binary_sink)->flush();
+                }
+                if (auto* l_mmap_sink = std::get_if< std::shared_ptr< MmapFileSink > >(&output)) {
+                    (*l_mmap_sink)->flush();
+                }
+                if (auto* l_network_sink = std::get_if< std::shared_ptr< NetworkSink > >(&output)) {
+                    (*l_network_sink)->flush();
+                }
+                if (auto* l_journal_sink = std::get_if< std::shared_ptr< JournalSink > >(&output)) {
+                    (*l_journal_sink)->flush();
+                }
+                for (const auto& l_extra: l_entry.extras) {
+                    l_extra->queue.waitUntilEmpty();
+                    l_extra->flushSinks();
+                }
+            }
+        }
+
+        /**
+         * \brief Drains the queue and joins the background writer thread.
+         *
+         * Called automatically from the destructor; safe to call repeatedly.
+         */
+        void shutdown() {
+            if (m_queue != nullptr or m_ring != nullptr or m_sharded.load(std::memory_order_acquire)) {
+                if (m_queue != nullptr) {
+                    m_queue->close();
+                }
+                if (m_ring != nullptr or m_sharded.load(std::memory_order_acquire)) {
+                    m_ring_closed.store(true, std::memory_order_release);
+                }
+                if (m_writer_thread != nullptr and m_writer_thread->joinable()) {
+                    m_writer_thread->join();
+                }
+            }
+            std::vector< FanOutSink* > l_closed;
+            for (auto& l_entry: m_entries) {
+                for (const auto& l_extra: l_entry.extras) {
+                    if (std::find(l_closed.begin(), l_closed.end(), l_extra.get()) == l_closed.end()) {
+                        l_extra->close();
+                        l_closed.push_back(l_extra.get());
+                    }
+                }
+            }
+        }
+
+        /**
+         * \brief Writes log message of preset format to preset output.
+         *
+         * In asynchronous mode (see enableAsync) the event is enqueued and the
+         * call returns immediately; otherwise formatting and I/O happen inline.
+         *
+         * \param log_event LogEvent&&
+         */
+        void write(LogEvent&& log_event) {
+            if (log_event.message_type == MessageType::Fatal and m_crash_mode.load(std::memory_order_relaxed)) {
+                writeFatalUnsafe(log_event.message.view());
+                return;
+            }
+            if (not passesFilters(log_event.message_type, log_event.file_name, log_event.line)) {
+                return;
+            }
+            writeChecked(std::move(log_event));
+        }
+
+        /**
+         * \brief Compile-time filtered write.
+         *
+         * When [Level] is disabled via the corresponding LOG_DISABLE_* macro
+         * the body vanishes at compile time: no LogEvent is constructed and no
+         * runtime check runs. Prefer this (or the MT_LOG_* macros, which also
+         * skip evaluation of the message expression) over the LogEvent&&
+         * overload for levels that may be compiled out.
+         *
+         * \tparam Level MessageType known at compile time
+         * \param p_message std::string_view
+         * \param p_source_location std::source_location
+         */
+        template < MessageType Level >
+        void write(const std::string_view p_message, const std::source_location p_source_location = std::source_location::current()) {
+            if constexpr (isMessageTypeEnabled< Level >()) {
+                if constexpr (Level == MessageType::Fatal) {
+                    if (m_crash_mode.load(std::memory_order_relaxed)) {
+                        writeFatalUnsafe(p_message);
+                        return;
+                    }
+                }
+                if (not passesFilters(Level, p_source_location.file_name(), p_source_location.line())) {
+                    return;
+                }
+                writeChecked(LogEvent{p_message, Level, p_source_location, ClockPolicy::now()});
+            }
+        }
+
+        /**
+         * \brief Lazy, compile-time filtered write with deferred formatting.
+         *
+         * Captures [p_format] (which must be a string literal) and the byte
+         * image of the arguments into the event; substitution of the "{}"
+         * placeholders happens on the sink thread, or not at all when the
+         * event never reaches a sink. When the level's output is
+         * std::monostate or the level is disabled, the call site costs a
+         * single branch — no string is built and no event is constructed.
+         *
+         * Arguments must be trivially copyable (arithmetic types, pointers to
+         * static strings, std::string_view over storage outliving the event).
+         *
+         * \tparam Level MessageType known at compile time
+         * \param p_format FormatWithLocation - "{}" format string, implicitly
+         * capturing the call site
+         * \param p_first First&& and \param p_rest Rest&&... - captured
+         * arguments
+         */
+        template < MessageType Level, class First, class... Rest >
+        void write(const FormatWithLocation p_format, First&& p_first, Rest&&... p_rest) {
+            if constexpr (isMessageTypeEnabled< Level >()) {
+                if constexpr (Level == MessageType::Fatal) {
+                    if (m_crash_mode.load(std::memory_order_relaxed)) {
+                        writeFatalUnsafe(p_format.format);
+                        return;
+                    }
+                }
+                if (std::holds_alternative< std::monostate >(m_entries[static_cast< size_t >(Level)].output)) {
+                    return;
+                }
+                if (not passesFilters(Level, p_format.location.file_name(), p_format.location.line())) {
+                    return;
+                }
+                using Payload = DeferredPayload< std::decay_t< First >, std::decay_t< Rest >... >;
+                static_assert(std::is_trivially_copyable_v< Payload >, "lazy write(): arguments must be trivially copyable");
+                const Payload l_payload = makeDeferredPayload(std::forward< First >(p_first), std::forward< Rest >(p_rest)...);
+                LogEvent l_event{std::string_view{reinterpret_cast< const char* >(&l_payload), sizeof(Payload)}, Level, p_format.location,
+                                 ClockPolicy::now()};
+                l_event.format = p_format.format;
+                l_event.deferred_render = &renderDeferred< Payload >;
+                writeChecked(std::move(l_event));
+            }
+        }
+
+        /**
+         * \struct Stats
+         * \brief Point-in-time instrumentation snapshot; plain data suitable
+         * for scraping into an external metrics system.
+         *
+         * write_latency_buckets[i] counts sink writes whose latency fell into
+         * [2^(i-1), 2^i) nanoseconds, so the distribution and tail of the
+         * actual I/O cost are visible without tracing.
+         */
+        struct Stats {
+            static constexpr size_t latency_bucket_count = 32;
+            uint64_t events_written[message_type_count]{};
+            uint64_t bytes_emitted{0};
+            uint64_t dropped_events{0};
+            uint64_t queue_high_water{0};
+            uint64_t flush_count{0};
+            uint64_t max_write_latency_ns{0};
+            uint64_t filtered_events{0};
+            uint64_t write_latency_buckets[latency_bucket_count]{};
+        };
+
+        /**
+         * \brief Reads the instrumentation counters into a Stats snapshot.
+         *
+         * The counters are updated with relaxed atomics on cache lines of
+         * their own, so reading them here never perturbs concurrent write()
+         * calls; the snapshot is consistent per counter, not across counters.
+         *
+         * \return Stats
          */
-        void setFormatter(MessageType message_type, std::function< std::string(const LogEvent& log_event) >&& formatter) {
-            m_formatters.at(static_cast< size_t >(message_type)) = formatter;
+        [[nodiscard]] auto snapshotStats() const -> Stats {
+            Stats l_stats;
+            for (size_t i = 0; i < message_type_count; ++i) {
+                l_stats.events_written[i] = m_events_written[i].value.load(std::memory_order_relaxed);
+            }
+            l_stats.bytes_emitted = m_bytes_emitted.value.load(std::memory_order_relaxed);
+            l_stats.dropped_events = m_dropped_events.value.load(std::memory_order_relaxed);
+            if (m_queue != nullptr) {
+                l_stats.dropped_events += m_queue->dropped();
+            }
+            l_stats.queue_high_water = m_queue_high_water.value.load(std::memory_order_relaxed);
+            l_stats.flush_count = m_flush_count.value.load(std::memory_order_relaxed);
+            l_stats.max_write_latency_ns = m_max_write_latency.value.load(std::memory_order_relaxed);
+            l_stats.filtered_events = m_filtered_events.value.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < Stats::latency_bucket_count; ++i) {
+                l_stats.write_latency_buckets[i] = m_latency_buckets[i].value.load(std::memory_order_relaxed);
+            }
+            return l_stats;
         }
 
+        ~Log() { shutdown(); }
+
+    private:
         /**
-         * \brief Writes log message of preset format to preset output.
+         * \internal
+         * \brief Runtime filter and queue dispatch shared by the write()
+         * overloads. The LOG_DISABLE_* checks here only matter for events
+         * built through the LogEvent&& overload, whose level is not known at
+         * compile time.
          * \param log_event LogEvent&&
          */
-        void write(LogEvent&& log_event) {
+        void writeChecked(LogEvent&& log_event) {
 #if defined(LOG_DISABLE_TRACE)
             if (log_event.message_type == MessageType::Trace) {
                 return;
@@ -370,19 +1708,562 @@ namespace mt::log {
                 return;
             }
 #endif
-            static int32_t message_index{0};
+            log_event.sequence = m_sequence.fetch_add(1, std::memory_order_relaxed);
+            m_events_written[static_cast< size_t >(log_event.message_type)].value.fetch_add(1, std::memory_order_relaxed);
+            if (m_sharded.load(std::memory_order_relaxed)) {
+                if (Shard* l_shard = currentShard()) {
+                    while (not l_shard->ring.tryPush(std::move(log_event))) {
+                        std::this_thread::yield();
+                    }
+                    return;
+                }
+            }
+            if (m_ring != nullptr) {
+                while (not m_ring->tryPush(std::move(log_event))) {
+                    if (m_ring_policy == OverflowPolicy::DropNewest) {
+                        m_dropped_events.value.fetch_add(1, std::memory_order_relaxed);
+                        return;
+                    }
+                    if (m_ring_policy == OverflowPolicy::DropOldest) {
+                        if (m_ring->tryPop().has_value()) {
+                            m_ring_written.fetch_add(1, std::memory_order_release);
+                            m_dropped_events.value.fetch_add(1, std::memory_order_relaxed);
+                        }
+                        continue;
+                    }
+                    std::this_thread::yield();
+                }
+                const auto l_pending = m_ring_pushed.fetch_add(1, std::memory_order_release) + 1 - m_ring_written.load(std::memory_order_relaxed);
+                updateMaximum(m_queue_high_water, l_pending);
+                return;
+            }
+            if (m_queue != nullptr) {
+                if (m_queue->push(std::move(log_event))) {
+                    updateMaximum(m_queue_high_water, m_queue->size());
+                }
+                return;
+            }
+            writeDirect(std::move(log_event));
+        }
+
+        /**
+         * \internal
+         * \brief Per-thread table mapping Log instances to the shard this
+         * thread attached; a handful of entries at most, so a linear scan is
+         * cheaper than any map.
+         */
+        static auto threadShardRegistry() -> std::vector< std::pair< const Log*, Shard* > >& {
+            thread_local std::vector< std::pair< const Log*, Shard* > > t_registry;
+            return t_registry;
+        }
+
+        auto currentShard() const -> Shard* {
+            for (const auto& [l_log, l_shard]: threadShardRegistry()) {
+                if (l_log == this) {
+                    return l_shard;
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * \internal
+         * \brief Drains every registered shard into [p_batch] and prunes
+         * shards whose owning thread detached. Runs on the harvester thread.
+         */
+        void harvestShards(std::vector< LogEvent >& p_batch) {
+            m_harvester_busy.store(true, std::memory_order_release);
+            std::vector< std::shared_ptr< Shard > > l_snapshot;
+            {
+                std::scoped_lock lock(m_shards_mutex);
+                std::erase_if(m_shards, [](const std::shared_ptr< Shard >& p_shard) -> bool {
+                    return p_shard->detached.load(std::memory_order_acquire) and p_shard->ring.empty();
+                });
+                l_snapshot = m_shards;
+            }
+            for (auto& l_shard: l_snapshot) {
+                while (auto l_event = l_shard->ring.tryPop()) {
+                    p_batch.emplace_back(std::move(*l_event));
+                }
+            }
+        }
+
+        auto shardsPending() -> bool {
+            std::scoped_lock lock(m_shards_mutex);
+            for (const auto& l_shard: m_shards) {
+                if (not l_shard->ring.empty()) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        struct PerTypeEntry;
+
+        /**
+         * \internal
+         * \brief Per-message-type filter configuration and state; padded so
+         * the sampling and bucket atomics of different types do not
+         * false-share.
+         *
+         * [bucket_state] packs the bucket's last-refill time in milliseconds
+         * (high 32 bits, wrapping) with its fill in milli-tokens (low 32
+         * bits), so the whole token bucket is one CAS on the fast path.
+         */
+        struct alignas(cache_line_size) TypeFilter {
+            double rate_milli_per_ms{0};
+            uint32_t burst_milli{0};
+            std::atomic< uint64_t > bucket_state{0};
+            uint32_t keep_one_in{0};
+            std::atomic< uint32_t > sample_counter{0};
+            std::chrono::milliseconds dedup_window{0};
+            std::mutex dedup_mutex;
+
+            struct DedupEntry {
+                uint64_t count{0};
+                std::chrono::steady_clock::time_point window_start{};
+            };
+
+            /**
+             * \internal
+             * \brief Per-call-site suppression state, allocated on the first
+             * suppressed-type write so an unconfigured filter costs nothing
+             * and the enclosing Log stays constant-initializable.
+             */
+            std::unique_ptr< std::map< std::pair< const char*, uint32_t >, DedupEntry > > dedup;
+        };
+
+        /**
+         * \internal
+         * \brief Milliseconds since the first call; wrapping uint32 arithmetic
+         * keeps the token bucket correct across the 49-day wrap.
+         */
+        static auto elapsedMilliseconds() -> uint32_t {
+            static const auto start = std::chrono::steady_clock::now();
+            return static_cast< uint32_t >(std::chrono::duration_cast< std::chrono::milliseconds >(std::chrono::steady_clock::now() - start).count());
+        }
+
+        /**
+         * \internal
+         * \brief Takes one token from the type's bucket; a single relaxed CAS
+         * in the common case.
+         */
+        static auto tryConsumeToken(TypeFilter& p_filter) -> bool {
+            const auto l_now = elapsedMilliseconds();
+            auto l_state = p_filter.bucket_state.load(std::memory_order_relaxed);
+            for (;;) {
+                const auto l_last = static_cast< uint32_t >(l_state >> 32);
+                const auto l_tokens = static_cast< uint32_t >(l_state);
+                const auto l_refilled = std::min< uint64_t >(
+                    p_filter.burst_milli, l_tokens + static_cast< uint64_t >(static_cast< double >(l_now - l_last) * p_filter.rate_milli_per_ms));
+                const bool l_allow = l_refilled >= 1000;
+                const uint64_t l_new_state = (static_cast< uint64_t >(l_now) << 32) | (l_allow ? l_refilled - 1000 : l_refilled);
+                if (p_filter.bucket_state.compare_exchange_weak(l_state, l_new_state, std::memory_order_relaxed)) {
+                    return l_allow;
+                }
+            }
+        }
+
+        /**
+         * \internal
+         * \brief The filter stage: sampling, rate limit and duplicate
+         * suppression, in that order. Runs before any message string or
+         * LogEvent exists; a false return has cost a few atomics at most.
+         * Emits the pending "suppressed N" summary when a call site passes
+         * again after a suppression window.
+         */
+        auto passesFilters(const MessageType p_message_type, const std::string_view p_file_name, const uint32_t p_line) -> bool {
+            auto& l_filter = m_filters[static_cast< size_t >(p_message_type)];
+            if (l_filter.keep_one_in > 1 and l_filter.sample_counter.fetch_add(1, std::memory_order_relaxed) % l_filter.keep_one_in != 0) {
+                m_filtered_events.value.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (l_filter.rate_milli_per_ms > 0 and not tryConsumeToken(l_filter)) {
+                m_filtered_events.value.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (l_filter.dedup_window.count() > 0) {
+                uint64_t l_suppressed = 0;
+                {
+                    const auto l_now = std::chrono::steady_clock::now();
+                    std::scoped_lock lock(l_filter.dedup_mutex);
+                    if (l_filter.dedup == nullptr) {
+                        l_filter.dedup = std::make_unique< std::map< std::pair< const char*, uint32_t >, typename TypeFilter::DedupEntry > >();
+                    }
+                    auto& l_entry = (*l_filter.dedup)[{p_file_name.data(), p_line}];
+                    if (l_entry.window_start != std::chrono::steady_clock::time_point{} and l_now - l_entry.window_start < l_filter.dedup_window) {
+                        ++l_entry.count;
+                        m_filtered_events.value.fetch_add(1, std::memory_order_relaxed);
+                        return false;
+                    }
+                    l_suppressed = l_entry.count;
+                    l_entry.count = 0;
+                    l_entry.window_start = l_now;
+                }
+                if (l_suppressed > 0) {
+                    emitSuppressionSummary(p_message_type, p_file_name, p_line, l_suppressed);
+                }
+            }
+            return true;
+        }
+
+        /**
+         * \internal
+         * \brief Emits a suppression summary event through the normal write
+         * pipeline. The summary carries the suppressed call site so it lands
+         * next to the messages it stands for.
+         */
+        void emitSuppressionSummary(const MessageType p_message_type, const std::string_view p_file_name, const uint32_t p_line, const uint64_t p_suppressed) {
+            std::string l_summary = "suppressed ";
+            appendValue(l_summary, p_suppressed);
+            l_summary += " similar messages";
+            writeChecked(LogEvent{l_summary, p_message_type, "", p_file_name, p_line});
+        }
+
+        /**
+         * \internal
+         * \brief Emits summaries for call sites whose suppression window has
+         * expired without a further message; called from flush() so counts
+         * are not lost when a site goes quiet.
+         */
+        void flushSuppressed() {
+            for (size_t l_type = 0; l_type < message_type_count; ++l_type) {
+                auto& l_filter = m_filters[l_type];
+                if (l_filter.dedup_window.count() == 0) {
+                    continue;
+                }
+                struct PendingSummary {
+                    const char* file_name;
+                    uint32_t line;
+                    uint64_t count;
+                };
+                std::vector< PendingSummary > l_pending;
+                {
+                    const auto l_now = std::chrono::steady_clock::now();
+                    std::scoped_lock lock(l_filter.dedup_mutex);
+                    if (l_filter.dedup == nullptr) {
+                        continue;
+                    }
+                    for (auto& [l_site, l_entry]: *l_filter.dedup) {
+                        if (l_entry.count > 0 and l_now - l_entry.window_start >= l_filter.dedup_window) {
+                            l_pending.push_back({l_site.first, l_site.second, l_entry.count});
+                            l_entry.count = 0;
+                            l_entry.window_start = l_now;
+                        }
+                    }
+                }
+                for (const auto& l_summary: l_pending) {
+                    emitSuppressionSummary(static_cast< MessageType >(l_type), l_summary.file_name, l_summary.line, l_summary.count);
+                }
+            }
+        }
+
+        /**
+         * \internal
+         * \brief A secondary destination with its own bounded hand-off queue
+         * and drain thread, so a slow sink sheds load (per its overflow
+         * policy) without stalling the primary output or its siblings.
+         * Receives refcounted already-formatted buffers — fan-out never
+         * re-formats. Destinations that consume whole events (binary sinks,
+         * flight recorders) or reopen per write (paths) are not supported
+         * here and are ignored.
+         */
+        struct FanOutSink {
+            FanOutSink(Output p_output, const size_t p_queue_capacity, const OverflowPolicy p_overflow_policy) :
+                output(std::move(p_output)),
+                queue(p_queue_capacity, p_overflow_policy) {
+                drain = std::thread([this]() -> void {
+                    std::vector< std::shared_ptr< const std::string > > l_batch;
+                    while (queue.popBatch(l_batch)) {
+                        for (const auto& l_message: l_batch) {
+                            writeOne(*l_message);
+                        }
+                        l_batch.clear();
+                        queue.drainComplete();
+                    }
+                });
+            }
+
+            FanOutSink(const FanOutSink&) = delete;
+            FanOutSink(FanOutSink&&) = delete;
+            FanOutSink& operator=(const FanOutSink&) = delete;
+            FanOutSink& operator=(FanOutSink&&) = delete;
+
+            void writeOne(const std::string& p_message) {
+                std::visit(
+                    [&p_message]< typename DestinationType >(DestinationType&& arg) -> void {
+                        using T = std::decay_t< DestinationType >;
+                        if constexpr (std::is_same_v< T, std::ostream* >) {
+                            arg->write(p_message.data(), std::ssize(p_message));
+                        } else if constexpr (std::is_same_v< T, std::shared_ptr< FileSink > >) {
+                            arg->write(p_message);
+                        } else if constexpr (std::is_same_v< T, std::shared_ptr< MmapFileSink > >) {
+                            arg->write(p_message);
+                        } else if constexpr (std::is_same_v< T, std::shared_ptr< ShmChannelProducer > >) {
+                            arg->write(p_message);
+                        } else if constexpr (std::is_same_v< T, std::shared_ptr< NetworkSink > >) {
+                            arg->write(p_message);
+                        } else if constexpr (std::is_same_v< T, std::shared_ptr< JournalSink > >) {
+                            arg->write(p_message);
+                        } else if constexpr (std::is_same_v< T, std::function< void(const std::string&) > >) {
+                            arg(p_message);
+                        }
+                    },
+                    output);
+            }
+
+            void flushSinks() {
+                if (auto* l_sink = std::get_if< std::shared_ptr< FileSink > >(&output)) {
+                    (*l_sink)->flush();
+                }
+                if (auto* l_mmap_sink = std::get_if< std::shared_ptr< MmapFileSink > >(&output)) {
+                    (*l_mmap_sink)->flush();
+                }
+                if (auto* l_network_sink = std::get_if< std::shared_ptr< NetworkSink > >(&output)) {
+                    (*l_network_sink)->flush();
+                }
+                if (auto* l_journal_sink = std::get_if< std::shared_ptr< JournalSink > >(&output)) {
+                    (*l_journal_sink)->flush();
+                }
+            }
+
+            void close() {
+                queue.close();
+                if (drain.joinable()) {
+                    drain.join();
+                }
+            }
+
+            ~FanOutSink() { close(); }
+
+            Output output;
+            EventQueue< std::shared_ptr< const std::string > > queue;
+            std::thread drain;
+        };
+
+        /**
+         * \internal
+         * \brief Hot-path instrumentation counter occupying a cache line of
+         * its own, so producers bumping different counters do not add the
+         * very contention the counters exist to measure.
+         */
+        struct alignas(cache_line_size) PaddedCounter {
+            std::atomic< uint64_t > value{0};
+        };
+
+        /**
+         * \internal
+         * \brief Formats the event and performs the I/O. Runs on the caller's
+         * thread in synchronous mode and on the writer thread otherwise.
+         * \param log_event LogEvent&&
+         */
+        void writeDirect(LogEvent&& log_event) {
             const auto message_type_index = static_cast< uint64_t >(log_event.message_type);
-            log_event.message_type_string = m_message_types.at(message_type_index);
+            const bool is_fatal = log_event.message_type == MessageType::Fatal;
+            PerTypeEntry& l_entry = m_entries[message_type_index];
+            if (auto* l_binary_sink = std::get_if< std::shared_ptr< BinarySink > >(&l_entry.output)) {
+                log_event.message_type_string = l_entry.label;
+                log_event.module_name = m_module_name;
+                std::scoped_lock lock(m_mutex);
+                (*l_binary_sink)->write(log_event);
+                return;
+            }
+            if (auto* l_recorder = std::get_if< std::shared_ptr< FlightRecorderSink > >(&l_entry.output)) {
+                log_event.message_type_string = l_entry.label;
+                log_event.module_name = m_module_name;
+                (*l_recorder)->record(std::move(log_event));
+                if (is_fatal) {
+                    dumpFlightRecorders();
+                }
+                return;
+            }
+            thread_local std::string formatting_buffer;
+            std::string& msg = formatting_buffer;
+            msg.clear();
+            formatEvent(log_event, l_entry, msg);
+            emitFormatted(l_entry, msg, is_fatal);
+            if (is_fatal) {
+                dumpFlightRecorders();
+            }
+        }
+
+        /**
+         * \internal
+         * \brief Dumps every flight recorder configured as an output once,
+         * triggered by a Fatal event reaching a sink.
+         */
+        void dumpFlightRecorders() {
+            std::vector< FlightRecorderSink* > l_dumped;
+            std::scoped_lock lock(m_mutex);
+            for (auto& l_entry: m_entries) {
+                if (auto* l_recorder = std::get_if< std::shared_ptr< FlightRecorderSink > >(&l_entry.output)) {
+                    if (std::find(l_dumped.begin(), l_dumped.end(), l_recorder->get()) == l_dumped.end()) {
+                        (*l_recorder)->dumpOnFatal();
+                        l_dumped.push_back(l_recorder->get());
+                    }
+                }
+            }
+        }
+
+        /**
+         * \internal
+         * \brief Destination identity used to coalesce consecutive batch
+         * events into one output call. Returns nullptr for destinations that
+         * cannot take a coalesced buffer cheaply or that frame each write as
+         * one record (paths reopened per write, binary sinks, journals,
+         * callbacks), which forces per-event emission.
+         */
+        static auto sinkKey(const PerTypeEntry& p_entry) -> const void* {
+            if (not p_entry.extras.empty()) {
+                return nullptr;
+            }
+            if (const auto* l_stream = std::get_if< std::ostream* >(&p_entry.output)) {
+                return *l_stream;
+            }
+            if (const auto* l_file = std::get_if< std::shared_ptr< FileSink > >(&p_entry.output)) {
+                return l_file->get();
+            }
+            if (const auto* l_mmap = std::get_if< std::shared_ptr< MmapFileSink > >(&p_entry.output)) {
+                return l_mmap->get();
+            }
+            if (const auto* l_network = std::get_if< std::shared_ptr< NetworkSink > >(&p_entry.output)) {
+                return l_network->get();
+            }
+            return nullptr;
+        }
+
+        /**
+         * \internal
+         * \brief Appends the "pid-sequence: " prefix and the formatted line
+         * for [log_event] to [p_out].
+         */
+        void formatEvent(LogEvent& log_event, PerTypeEntry& l_entry, std::string& p_out) {
+            log_event.message_type_string = l_entry.label;
             log_event.module_name = m_module_name;
-            std::string msg = std::to_string(processID()) + "-" + std::to_string(message_index) + ": ";
-            if (not m_formatters.empty()) {
-                const auto formatter = m_formatters.at(message_type_index);
-                msg += log_event.toString(formatter);
+            log_event.sanitize = m_sanitize;
+            static const uint64_t process_id = processID();
+            appendUnsigned(p_out, process_id);
+            p_out += '-';
+            appendUnsigned(p_out, log_event.sequence);
+            p_out += ": ";
+            if (l_entry.formatter != nullptr and *l_entry.formatter != nullptr) {
+                log_event.toString(p_out, *l_entry.formatter);
             } else {
-                msg += log_event.toString();
+                StaticFormatter{}(log_event, p_out);
+            }
+        }
+
+        /**
+         * \internal
+         * \brief Drains a batch of events with coalesced I/O.
+         *
+         * Consecutive events that resolve to the same destination are
+         * formatted back to back into one contiguous buffer which is handed
+         * to the sink as a single write, so a burst costs one kernel write
+         * per run of same-destination events instead of one per message.
+         * Destinations sinkKey() declines to coalesce go through per-event
+         * writeDirect().
+         * \param p_batch std::vector\<LogEvent\>&
+         */
+        void writeBatch(std::vector< LogEvent >& p_batch) {
+            thread_local std::string coalesce_buffer;
+            std::string& l_buffer = coalesce_buffer;
+            PerTypeEntry* l_run_entry = nullptr;
+            const void* l_run_key = nullptr;
+            bool l_run_fatal = false;
+            const auto l_flush_run = [this, &l_buffer, &l_run_entry, &l_run_key, &l_run_fatal]() -> void {
+                if (l_run_entry != nullptr and not l_buffer.empty()) {
+                    emitFormatted(*l_run_entry, l_buffer, l_run_fatal);
+                }
+                l_buffer.clear();
+                l_run_entry = nullptr;
+                l_run_key = nullptr;
+                l_run_fatal = false;
+            };
+            for (auto& l_event: p_batch) {
+                PerTypeEntry& l_entry = m_entries[static_cast< size_t >(l_event.message_type)];
+                const void* l_key = sinkKey(l_entry);
+                if (l_key == nullptr) {
+                    l_flush_run();
+                    writeDirect(std::move(l_event));
+                    continue;
+                }
+                if (l_key != l_run_key) {
+                    l_flush_run();
+                }
+                formatEvent(l_event, l_entry, l_buffer);
+                l_run_entry = &l_entry;
+                l_run_key = l_key;
+                if (l_event.message_type == MessageType::Fatal) {
+                    l_run_fatal = true;
+                    l_flush_run();
+                    dumpFlightRecorders();
+                }
+            }
+            l_flush_run();
+        }
+
+        /**
+         * \internal
+         * \brief Writes an already formatted buffer to the destination of
+         * [l_entry]. [msg] may hold a single line or a coalesced batch.
+         * \param l_entry PerTypeEntry&
+         * \param msg const std::string&
+         * \param is_fatal bool
+         */
+        void emitFormatted(PerTypeEntry& l_entry, const std::string& msg, const bool is_fatal) {
+            if (not l_entry.extras.empty()) {
+                const auto l_shared = std::make_shared< const std::string >(msg);
+                for (const auto& l_extra: l_entry.extras) {
+                    auto l_copy = l_shared;
+                    l_extra->queue.push(std::move(l_copy));
+                }
+            }
+            if (not m_non_throwing) {
+                emitToSink(l_entry, msg, is_fatal);
+                return;
+            }
+            if (l_entry.failed.load(std::memory_order_acquire)) {
+                if (m_fallback_to_stderr) {
+                    writeFallback(msg);
+                }
+                return;
+            }
+            try {
+                emitToSink(l_entry, msg, is_fatal);
+            } catch (const std::exception& l_error) {
+                l_entry.failed.store(true, std::memory_order_release);
+                if (m_error_callback != nullptr and *m_error_callback != nullptr) {
+                    (*m_error_callback)(static_cast< MessageType >(&l_entry - m_entries.data()), l_error.what());
+                }
+                if (m_fallback_to_stderr) {
+                    writeFallback(msg);
+                }
             }
+        }
+
+        /**
+         * \internal
+         * \brief Writes [msg] to stderr when a failed sink's messages are
+         * diverted in the non-throwing mode.
+         * \param msg const std::string&
+         */
+        void writeFallback(const std::string& msg) {
+            std::scoped_lock lock(m_mutex);
+            std::cerr.write(msg.data(), std::ssize(msg));
+        }
+
+        /**
+         * \internal
+         * \brief Hands the formatted buffer to the configured destination.
+         * \param l_entry PerTypeEntry&
+         * \param msg const std::string&
+         * \param is_fatal bool
+         */
+        void emitToSink(PerTypeEntry& l_entry, const std::string& msg, const bool is_fatal) {
+            const auto l_start = std::chrono::steady_clock::now();
             std::visit(
-                [this, &msg]< typename DestinationType >(DestinationType&& arg) -> void {
+                [this, &msg, is_fatal, &l_entry]< typename DestinationType >(DestinationType&& arg) -> void {
                     using T = std::decay_t< DestinationType >;
                     if constexpr (std::is_same_v< T, std::ostream* >) {
                         std::scoped_lock lock(m_mutex);
@@ -435,17 +2316,42 @@ namespace mt::log {
                                 }
                             },
                             m_ipc_mutex);
+                    } else if constexpr (std::is_same_v< T, std::shared_ptr< FileSink > >) {
+                        std::scoped_lock lock(m_mutex);
+                        arg->write(msg, is_fatal);
+                    } else if constexpr (std::is_same_v< T, std::shared_ptr< MmapFileSink > >) {
+                        std::scoped_lock lock(m_mutex);
+                        arg->write(msg);
+                    } else if constexpr (std::is_same_v< T, std::shared_ptr< ShmChannelProducer > >) {
+                        std::scoped_lock lock(m_mutex);
+                        arg->write(msg);
+                    } else if constexpr (std::is_same_v< T, std::shared_ptr< NetworkSink > >) {
+                        arg->write(msg);
+                    } else if constexpr (std::is_same_v< T, std::shared_ptr< JournalSink > >) {
+                        arg->write(msg, is_fatal or l_entry.durable);
                     } else if constexpr (std::is_same_v< T, std::function< void(const std::string&) > >) {
                         arg(msg);
                     }
                 },
-                m_outputs.at(message_type_index));
-            ++message_index;
+                l_entry.output);
+            const auto l_latency = static_cast< uint64_t >(
+                std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now() - l_start).count());
+            m_bytes_emitted.value.fetch_add(msg.size(), std::memory_order_relaxed);
+            updateMaximum(m_max_write_latency, l_latency);
+            const auto l_bucket = std::min< size_t >(std::bit_width(l_latency), Stats::latency_bucket_count - 1);
+            m_latency_buckets[l_bucket].value.fetch_add(1, std::memory_order_relaxed);
         }
 
-        ~Log() = default;
+        /**
+         * \internal
+         * \brief Raises [p_counter] to [p_value] if it is below it; the usual
+         * relaxed CAS-max.
+         */
+        static void updateMaximum(PaddedCounter& p_counter, const uint64_t p_value) {
+            auto l_current = p_counter.value.load(std::memory_order_relaxed);
+            while (p_value > l_current and not p_counter.value.compare_exchange_weak(l_current, p_value, std::memory_order_relaxed)) { }
+        }
 
-    private:
         ThreadMutex m_mutex;
         std::variant< std::monostate, std::reference_wrapper< IPCMutex >, IPCMutex*, IPCMutex > m_ipc_mutex;
         // std::optional< IPCMutex > m_ipc_mutex{std::nullopt};
@@ -453,23 +2359,177 @@ namespace mt::log {
 
         /**
          * \internal
-         * \brief Stores string representations of message types.
+         * \brief Non-throwing failure mode configuration; see
+         * enableNonThrowing().
+         */
+        bool m_non_throwing{false};
+        bool m_fallback_to_stderr{true};
+        bool m_sanitize{false};
+        std::shared_ptr< const std::function< void(MessageType message_type, const std::string& reason) > > m_error_callback;
+
+        /**
+         * \internal
+         * \brief Per-message-type configuration: label, output destination and
+         * formatter kept side by side so a single write touches one entry
+         * instead of three heap-allocated vectors.
+         */
+        struct PerTypeEntry {
+            std::string label;
+            Output output{&std::cout};
+
+            /**
+             * \internal
+             * \brief Optional runtime formatter, behind a pointer so a
+             * default-constructed entry is constant-initializable (see the
+             * class note on constinit) and entries sharing a global
+             * formatter share one allocation.
+             */
+            std::shared_ptr< const std::function< std::string(const LogEvent& log_event) > > formatter;
+            std::atomic< bool > failed{false};
+
+            /**
+             * \internal
+             * \brief Secondary fan-out sinks added via addOutput(), each with
+             * its own queue and drain thread.
+             */
+            std::vector< std::shared_ptr< FanOutSink > > extras;
+
+            /**
+             * \internal
+             * \brief Whether writes of this type block until durable on a
+             * JournalSink output; see setDurableWrites.
+             */
+            bool durable{false};
+        };
+
+        std::array< PerTypeEntry, message_type_count > m_entries{{{"TRACE", {&std::cout}, {}, {false}, {}},
+                                                                  {"DEBUG", {&std::cout}, {}, {false}, {}},
+                                                                  {"ERROR", {&std::cout}, {}, {false}, {}},
+                                                                  {"WARNING", {&std::cout}, {}, {false}, {}},
+                                                                  {"INFO", {&std::cout}, {}, {false}, {}},
+                                                                  {"FATAL", {&std::cout}, {}, {false}, {}}}};
+
+        /**
+         * \internal
+         * \brief Hand-off queue between write() callers and the writer thread.
+         * Non-null only after enableAsync().
+         */
+        /**
+         * \internal
+         * \brief Per-type filter stage state; see setRateLimit, setSampling
+         * and setDuplicateSuppression.
+         */
+        std::array< TypeFilter, message_type_count > m_filters{};
+
+        std::unique_ptr< EventQueue< LogEvent > > m_queue;
+
+        /**
+         * \internal
+         * \brief Monotonic event sequence for this instance; relaxed ordering
+         * is sufficient since only uniqueness and monotonicity matter. Padded
+         * to its own cache line so contending producers do not false-share
+         * with the rest of the instance.
+         */
+        alignas(cache_line_size) std::atomic< uint64_t > m_sequence{0};
+
+        /**
+         * \internal
+         * \brief Instrumentation counters behind snapshotStats().
+         */
+        std::array< PaddedCounter, message_type_count > m_events_written{};
+        PaddedCounter m_bytes_emitted;
+        PaddedCounter m_dropped_events;
+        PaddedCounter m_queue_high_water;
+        PaddedCounter m_flush_count;
+        PaddedCounter m_max_write_latency;
+        PaddedCounter m_filtered_events;
+
+        /**
+         * \internal
+         * \brief Crash-mode flag and the pre-opened descriptor used by
+         * writeFatalUnsafe(); see enableCrashMode().
+         */
+        std::atomic< bool > m_crash_mode{false};
+        std::atomic< int > m_crash_fd{2};
+        std::array< PaddedCounter, Stats::latency_bucket_count > m_latency_buckets{};
+
+        /**
+         * \internal
+         * \brief Lock-free hand-off ring used when enableAsync selected
+         * QueueKind::LockFree. Mutually exclusive with [m_queue].
          */
-        std::vector< std::string > m_message_types;
+        std::unique_ptr< MpscRing< LogEvent > > m_ring;
+        OverflowPolicy m_ring_policy{OverflowPolicy::Block};
+        std::atomic< bool > m_ring_closed{false};
+        std::atomic< uint64_t > m_ring_pushed{0};
+        std::atomic< uint64_t > m_ring_written{0};
 
         /**
          * \internal
-         * \brief Stores output for each message type.
+         * \brief Sharded-mode state: registry of per-thread staging buffers
+         * harvested by the writer thread.
          */
-        std::vector< std::variant< std::monostate, std::ostream*, std::filesystem::path, std::function< void(const std::string&) > > > m_outputs;
+        std::atomic< bool > m_sharded{false};
+        size_t m_shard_capacity{1024};
+        std::atomic< bool > m_harvester_busy{false};
+        std::mutex m_shards_mutex;
+        std::vector< std::shared_ptr< Shard > > m_shards;
 
         /**
          * \internal
-         * \brief Stores formatter functions for each message type.
+         * \brief Background thread draining the hand-off queue in asynchronous
+         * mode.
+         */
+        /**
+         * \internal
+         * \brief Held behind a pointer (std::thread's default constructor is
+         * not constexpr in current standard libraries) so a default Log is
+         * constant-initializable; allocated only when enableAsync starts it.
          */
-        std::vector< std::function< std::string(const LogEvent& log_event) > > m_formatters;
+        std::unique_ptr< std::thread > m_writer_thread;
     };
 
 }  // namespace mt::log
 
+/**
+ * Call-site convenience macros. Unlike the write() member functions these also
+ * remove evaluation of the message expression when the level is disabled via
+ * the corresponding LOG_DISABLE_* macro, so a disabled call site compiles to
+ * literally nothing.
+ */
+#if defined(LOG_DISABLE_TRACE)
+  #define MT_LOG_TRACE(p_log, p_message) static_cast< void >(0)
+#else
+  #define MT_LOG_TRACE(p_log, p_message) (p_log).write< mt::log::MessageType::Trace >(p_message)
+#endif
+#if defined(LOG_DISABLE_DEBUG)
+  #define MT_LOG_DEBUG(p_log, p_message) static_cast< void >(0)
+#else
+  #define MT_LOG_DEBUG(p_log, p_message) (p_log).write< mt::log::MessageType::Debug >(p_message)
+#endif
+#if defined(LOG_DISABLE_ERROR)
+  #define MT_LOG_ERROR(p_log, p_message) static_cast< void >(0)
+#else
+  #define MT_LOG_ERROR(p_log, p_message) (p_log).write< mt::log::MessageType::Error >(p_message)
+#endif
+#if defined(LOG_DISABLE_WARNING)
+  #define MT_LOG_WARNING(p_log, p_message) static_cast< void >(0)
+#else
+  #define MT_LOG_WARNING(p_log, p_message) (p_log).write< mt::log::MessageType::Warning >(p_message)
+#endif
+#if defined(LOG_DISABLE_INFO)
+  #define MT_LOG_INFO(p_log, p_message) static_cast< void >(0)
+#else
+  #define MT_LOG_INFO(p_log, p_message) (p_log).write< mt::log::MessageType::Info >(p_message)
+#endif
+#if defined(LOG_DISABLE_FATAL)
+  #define MT_LOG_FATAL(p_log, p_message) static_cast< void >(0)
+#else
+  #define MT_LOG_FATAL(p_log, p_message) (p_log).write< mt::log::MessageType::Fatal >(p_message)
+#endif
+
+#if defined(MT_LOG_HEADER_ONLY)
+  #include "log.ipp"
+#endif
+
 #endif  // MT_LOG_HPP
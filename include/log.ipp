@@ -0,0 +1,315 @@
+/**
+ * \file log.ipp
+ * \brief Out-of-line definitions for log.hpp: LogEvent, the crash record writer, FlightRecorderSink and the binary format.
+ *
+ * Compiled once into the log library in the default build; included
+ * inline by the headers when MT_LOG_HEADER_ONLY is defined (the header-only
+ * CMake target does this), so short-lived tools can skip the library link.
+ */
+#ifndef MT_LOG_IPP
+#define MT_LOG_IPP
+
+#include "log.hpp"
+#include "binary_format.hpp"
+#include "flight_recorder.hpp"
+#include <cstdio>
+#include <ctime>
+#include <thread>
+
+#if (defined __linux) || (defined linux) || (defined __linux__) || (defined __OSX__) || (defined __APPLE__)
+  #include <unistd.h>
+#else
+  #define NOMINMAX
+  #include <windows.h>
+  #include <cerrno>
+  #include <io.h>
+#endif
+
+
+#ifndef MT_LOG_FUNC
+  #if defined(MT_LOG_HEADER_ONLY)
+    #define MT_LOG_FUNC inline
+  #else
+    #define MT_LOG_FUNC
+  #endif
+#endif
+
+namespace mt::log {
+
+    namespace detail {
+
+        /**
+         * \internal
+         * \brief Returns the "YYYY-MM-DDTHH:MM:SS" prefix for [p_seconds].
+         *
+         * At high message rates thousands of events share the same wall-clock
+         * second, so the formatted prefix is memoized per thread and re-derived
+         * (via the reentrant gmtime — std::gmtime returns a shared buffer that
+         * races across threads) only when the second actually changes.
+         */
+        MT_LOG_FUNC auto cachedTimePrefix(const std::time_t p_seconds) -> const std::string& {
+            thread_local std::time_t cached_second{-1};
+            thread_local std::string cached_prefix;
+            if (p_seconds != cached_second) {
+                std::tm time{};
+#if (defined __linux) || (defined linux) || (defined __linux__) || (defined __OSX__) || (defined __APPLE__)
+                gmtime_r(&p_seconds, &time);
+#else
+                gmtime_s(&time, &p_seconds);
+#endif
+                char buffer[32];
+                const auto length = std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02dT%02d:%02d:%02d", time.tm_year + 1900, time.tm_mon + 1, time.tm_mday,
+                                                  time.tm_hour, time.tm_min, time.tm_sec);
+                cached_prefix.assign(buffer, static_cast< size_t >(length));
+                cached_second = p_seconds;
+            }
+            return cached_prefix;
+        }
+
+    }  // namespace detail
+
+    MT_LOG_FUNC auto processID() -> uint64_t {
+#if (defined __linux) || (defined linux) || (defined __linux__)
+        return static_cast< uint64_t >(getpid());
+#else
+        return static_cast< uint64_t >(GetCurrentProcessId());
+#endif
+    }
+
+    MT_LOG_FUNC void writeCrashRecord(const int p_fd, const std::string_view p_message) noexcept {
+        char buffer[512];
+        size_t position = 0;
+        const auto append_bytes = [&buffer, &position](const char* p_data, const size_t p_length) -> void {
+            const auto count = std::min(p_length, sizeof(buffer) - position);
+            std::memcpy(buffer + position, p_data, count);
+            position += count;
+        };
+        const auto append_number = [&append_bytes](const uint64_t p_value) -> void {
+            char digits[20];
+            size_t index = sizeof(digits);
+            auto value = p_value;
+            do {
+                digits[--index] = static_cast< char >('0' + value % 10);
+                value /= 10;
+            } while (value != 0);
+            append_bytes(digits + index, sizeof(digits) - index);
+        };
+#if (defined __linux) || (defined linux) || (defined __linux__) || (defined __OSX__) || (defined __APPLE__)
+        timespec now {};
+        ::clock_gettime(CLOCK_REALTIME, &now);
+        const auto seconds = static_cast< uint64_t >(now.tv_sec);
+        const auto milliseconds = static_cast< uint64_t >(now.tv_nsec) / 1'000'000;
+        const auto pid = static_cast< uint64_t >(getpid());
+#else
+        const auto seconds = static_cast< uint64_t >(::time(nullptr));
+        const uint64_t milliseconds = 0;
+        const auto pid = static_cast< uint64_t >(GetCurrentProcessId());
+#endif
+        append_number(pid);
+        append_bytes(": ", 2);
+        append_number(seconds);
+        append_bytes(".", 1);
+        if (milliseconds < 100) {
+            append_bytes("0", 1);
+        }
+        if (milliseconds < 10) {
+            append_bytes("0", 1);
+        }
+        append_number(milliseconds);
+        append_bytes(" | FATAL | ", 11);
+        append_bytes(p_message.data(), p_message.size());
+        if (position == sizeof(buffer)) {
+            --position;
+        }
+        buffer[position++] = '\n';
+#if (defined __linux) || (defined linux) || (defined __linux__) || (defined __OSX__) || (defined __APPLE__)
+        const auto written = ::write(p_fd, buffer, position);
+        static_cast< void >(written);
+#else
+        static_cast< void >(_write(p_fd, buffer, static_cast< unsigned >(position)));
+#endif
+    }
+
+    MT_LOG_FUNC LogEvent::LogEvent(const std::string_view p_message, const MessageType p_message_type, const std::string_view p_function_name,
+                       const std::string_view p_file_name, const uint32_t p_line, const std::chrono::system_clock::time_point p_time_point) :
+        time_point(p_time_point),
+        message(p_message),
+        function_name(p_function_name),
+        file_name(p_file_name),
+        line(p_line),
+        thread_id(cachedThreadID()),
+        message_type(p_message_type) { }
+
+    MT_LOG_FUNC LogEvent::LogEvent(const std::string_view p_message, const MessageType p_message_type, const std::source_location p_source_location) :
+        LogEvent(p_message, p_message_type, p_source_location.function_name(), p_source_location.file_name(), p_source_location.line()) {
+        auto& table = InternTable::instance();
+        function_id = table.internPointer(p_source_location.function_name());
+        file_id = table.internPointer(p_source_location.file_name());
+    }
+
+    MT_LOG_FUNC LogEvent::LogEvent(const std::string_view p_message, const MessageType p_message_type, const std::source_location p_source_location,
+                       const std::chrono::system_clock::time_point p_time_point) :
+        LogEvent(p_message, p_message_type, p_source_location.function_name(), p_source_location.file_name(), p_source_location.line(), p_time_point) {
+        auto& table = InternTable::instance();
+        function_id = table.internPointer(p_source_location.function_name());
+        file_id = table.internPointer(p_source_location.file_name());
+    }
+
+    MT_LOG_FUNC LogEvent::~LogEvent() = default;
+
+    MT_LOG_FUNC FlightRecorderSink::FlightRecorderSink(const size_t p_capacity, std::ostream* p_fatal_dump_target) :
+        m_events(p_capacity == 0 ? 1 : p_capacity),
+        m_fatal_dump_target(p_fatal_dump_target) { }
+
+    MT_LOG_FUNC FlightRecorderSink::~FlightRecorderSink() = default;
+
+    MT_LOG_FUNC void FlightRecorderSink::record(LogEvent&& p_log_event) {
+        std::scoped_lock lock(m_mutex);
+        m_events[(m_head + m_size) % m_events.size()] = std::move(p_log_event);
+        if (m_size < m_events.size()) {
+            ++m_size;
+        } else {
+            m_head = (m_head + 1) % m_events.size();
+        }
+    }
+
+    MT_LOG_FUNC void FlightRecorderSink::dump(std::ostream& p_out, const std::function< std::string(const LogEvent&) >& p_formatter) {
+        std::scoped_lock lock(m_mutex);
+        std::string line;
+        for (size_t i = 0; i < m_size; ++i) {
+            const auto& l_event = m_events[(m_head + i) % m_events.size()];
+            line.clear();
+            l_event->toString(line, p_formatter);
+            p_out.write(line.data(), std::ssize(line));
+        }
+        p_out.flush();
+    }
+
+    MT_LOG_FUNC void FlightRecorderSink::dumpOnFatal() {
+        if (m_fatal_dump_target != nullptr) {
+            dump(*m_fatal_dump_target);
+        }
+    }
+
+    MT_LOG_FUNC void BinarySink::writeRecord(const BinaryRecordKind p_kind, const void* p_payload, const uint32_t p_length, const void* p_tail,
+                                 const uint32_t p_tail_length) {
+        char header[sizeof(uint8_t) + sizeof(uint32_t)];
+        header[0] = static_cast< char >(p_kind);
+        const uint32_t total_length = p_length + p_tail_length;
+        std::memcpy(header + 1, &total_length, sizeof(total_length));
+        m_file.write({header, sizeof(header)});
+        m_file.write({static_cast< const char* >(p_payload), p_length});
+        if (p_tail != nullptr) {
+            m_file.write({static_cast< const char* >(p_tail), p_tail_length});
+        }
+    }
+
+    MT_LOG_FUNC auto BinarySink::internGlobal(const uint32_t p_global_id, const std::string_view p_string) -> uint32_t {
+        const auto existing = m_global_to_local.find(p_global_id);
+        if (existing != m_global_to_local.end()) {
+            return existing->second;
+        }
+        const auto local_id = intern(p_string);
+        m_global_to_local.emplace(p_global_id, local_id);
+        return local_id;
+    }
+
+    MT_LOG_FUNC auto BinarySink::intern(const std::string_view p_string) -> uint32_t {
+        const auto existing = m_string_ids.find(p_string);
+        if (existing != m_string_ids.end()) {
+            return existing->second;
+        }
+        const auto id = m_next_string_id++;
+        m_string_ids.emplace(p_string, id);
+        writeRecord(BinaryRecordKind::StringDef, &id, sizeof(id), p_string.data(), static_cast< uint32_t >(p_string.size()));
+        return id;
+    }
+
+    MT_LOG_FUNC void BinarySink::write(const LogEvent& p_log_event) {
+        BinaryEventHeader header{};
+        header.sequence = p_log_event.sequence;
+        header.time_since_epoch_ns = std::chrono::duration_cast< std::chrono::nanoseconds >(p_log_event.time_point.time_since_epoch()).count();
+        header.thread_id_hash = p_log_event.thread_id.numeric;
+        header.line = p_log_event.line;
+        header.file_id = p_log_event.file_id != 0 ? internGlobal(p_log_event.file_id, p_log_event.file_name) : intern(p_log_event.file_name);
+        header.function_id = p_log_event.function_id != 0 ? internGlobal(p_log_event.function_id, p_log_event.function_name) : intern(p_log_event.function_name);
+        header.module_id = intern(p_log_event.module_name);
+        header.label_id = intern(p_log_event.message_type_string);
+        header.message_type = static_cast< uint8_t >(p_log_event.message_type);
+        auto message = p_log_event.message.view();
+        std::string rendered;
+        if (p_log_event.deferred_render != nullptr) {
+            p_log_event.appendMessage(rendered);
+            message = rendered;
+        }
+        writeRecord(BinaryRecordKind::Event, &header, sizeof(header), message.data(), static_cast< uint32_t >(message.size()));
+    }
+
+    MT_LOG_FUNC auto BinaryLogReader::next() -> std::optional< LogEvent > {
+        for (;;) {
+            char record_header[sizeof(uint8_t) + sizeof(uint32_t)];
+            if (not m_input.read(record_header, sizeof(record_header))) {
+                return std::nullopt;
+            }
+            const auto kind = static_cast< BinaryRecordKind >(record_header[0]);
+            uint32_t length = 0;
+            std::memcpy(&length, record_header + 1, sizeof(length));
+            std::string payload(length, '\0');
+            if (not m_input.read(payload.data(), static_cast< std::streamsize >(length))) {
+                return std::nullopt;
+            }
+            if (kind == BinaryRecordKind::StringDef) {
+                if (length < sizeof(uint32_t)) {
+                    return std::nullopt;
+                }
+                uint32_t id = 0;
+                std::memcpy(&id, payload.data(), sizeof(id));
+                m_strings[id] = payload.substr(sizeof(id));
+                continue;
+            }
+            if (kind != BinaryRecordKind::Event or length < sizeof(BinaryEventHeader)) {
+                return std::nullopt;
+            }
+            BinaryEventHeader header{};
+            std::memcpy(&header, payload.data(), sizeof(header));
+            const auto resolve = [this](const uint32_t p_id) -> std::string_view {
+                const auto entry = m_strings.find(p_id);
+                return entry == m_strings.end() ? std::string_view{} : std::string_view{entry->second};
+            };
+            const std::string_view message{payload.data() + sizeof(header), length - sizeof(header)};
+            LogEvent log_event{message, static_cast< MessageType >(header.message_type), resolve(header.function_id), resolve(header.file_id), header.line};
+            log_event.time_point = std::chrono::time_point< std::chrono::system_clock >(
+                std::chrono::duration_cast< std::chrono::system_clock::duration >(std::chrono::nanoseconds(header.time_since_epoch_ns)));
+            log_event.sequence = header.sequence;
+            log_event.message_type_string = resolve(header.label_id);
+            log_event.module_name = resolve(header.module_id);
+            return log_event;
+        }
+    }
+
+    MT_LOG_FUNC auto LogEvent::toString(const std::function< std::string(const LogEvent&) >& formatter) const -> std::string {
+        std::string result;
+        toString(result, formatter);
+        return result;
+    }
+
+    MT_LOG_FUNC void LogEvent::toString(std::string& p_out, const std::function< std::string(const LogEvent&) >& formatter) const {
+        if (formatter) {
+            p_out += formatter(*this);
+            return;
+        }
+        DefaultLayout::format(*this, p_out);
+    }
+
+    MT_LOG_FUNC void appendDefaultTimestamp(std::string& p_out, const std::chrono::system_clock::time_point p_time_point) {
+        const auto seconds = std::chrono::system_clock::to_time_t(p_time_point);
+        const auto milliseconds = std::chrono::duration_cast< std::chrono::milliseconds >(p_time_point.time_since_epoch()).count() % 1000;
+        p_out += detail::cachedTimePrefix(seconds);
+        p_out += '.';
+        p_out += static_cast< char >('0' + milliseconds / 100);
+        p_out += static_cast< char >('0' + milliseconds / 10 % 10);
+        p_out += static_cast< char >('0' + milliseconds % 10);
+    }
+}  // namespace mt::log
+
+#endif  // MT_LOG_IPP
@@ -0,0 +1,103 @@
+#ifndef MT_MESSAGE_BUFFER_HPP
+#define MT_MESSAGE_BUFFER_HPP
+
+#include <cstring>
+#include <string_view>
+
+#include "payload_pool.hpp"
+
+namespace mt::log {
+
+    /**
+     * \class MessageBuffer
+     * \brief Storage for a LogEvent message payload that avoids heap
+     * allocation for typical message sizes.
+     *
+     * Messages up to inline_capacity bytes are copied into an inline buffer
+     * inside the event itself; longer messages draw a chunk from the
+     * PayloadPool, which recycles fixed-size chunks across threads, and only
+     * when the pool is exhausted (or the message exceeds a chunk) does the
+     * buffer fall back to the heap. Together with the string_view
+     * source-location fields this makes constructing a LogEvent
+     * allocation-free on the hot path.
+     */
+    class MessageBuffer {
+    public:
+        static constexpr size_t inline_capacity = 128;
+
+        MessageBuffer() = default;
+
+        MessageBuffer(const std::string_view p_message) :  // NOLINT(*-explicit-constructor)
+            m_size(p_message.size()) {
+            if (m_size <= inline_capacity) {
+                std::memcpy(m_inline, p_message.data(), m_size);
+            } else {
+                m_external = PayloadPool::instance().acquire(m_size);
+                if (m_external == nullptr) {
+                    m_external = new char[m_size];
+                }
+                std::memcpy(m_external, p_message.data(), m_size);
+            }
+        }
+
+        MessageBuffer(const MessageBuffer& other) = delete;
+
+        MessageBuffer(MessageBuffer&& other) noexcept :
+            m_external(other.m_external),
+            m_size(other.m_size) {
+            if (m_external == nullptr) {
+                std::memcpy(m_inline, other.m_inline, m_size);
+            }
+            other.m_external = nullptr;
+            other.m_size = 0;
+        }
+
+        MessageBuffer& operator=(const MessageBuffer& other) = delete;
+
+        MessageBuffer& operator=(MessageBuffer&& other) noexcept {
+            if (this != &other) {
+                release();
+                m_external = other.m_external;
+                m_size = other.m_size;
+                if (m_external == nullptr) {
+                    std::memcpy(m_inline, other.m_inline, m_size);
+                }
+                other.m_external = nullptr;
+                other.m_size = 0;
+            }
+            return *this;
+        }
+
+        ~MessageBuffer() { release(); }
+
+        [[nodiscard]] auto view() const -> std::string_view {
+            return {m_external == nullptr ? m_inline : m_external, m_size};
+        }
+
+        operator std::string_view() const { return view(); }  // NOLINT(*-explicit-constructor)
+
+        [[nodiscard]] auto size() const -> size_t { return m_size; }
+
+        [[nodiscard]] auto empty() const -> bool { return m_size == 0; }
+
+    private:
+        void release() {
+            if (m_external != nullptr) {
+                auto& l_pool = PayloadPool::instance();
+                if (l_pool.owns(m_external)) {
+                    l_pool.release(m_external);
+                } else {
+                    delete[] m_external;
+                }
+                m_external = nullptr;
+            }
+        }
+
+        char m_inline[inline_capacity];
+        char* m_external{nullptr};
+        size_t m_size{0};
+    };
+
+}  // namespace mt::log
+
+#endif  // MT_MESSAGE_BUFFER_HPP
@@ -0,0 +1,91 @@
+#ifndef MT_MMAP_FILE_SINK_HPP
+#define MT_MMAP_FILE_SINK_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+namespace mt::log {
+
+    /**
+     * \enum MsyncPolicy
+     * \brief Controls how MmapFileSink::flush() pushes mapped pages to disk.
+     *
+     * \li None  - rely on the kernel writing dirty pages back on its own.
+     * \li Async - request asynchronous writeback (MS_ASYNC).
+     * \li Sync  - block until the pages are durable (MS_SYNC).
+     */
+    enum class MsyncPolicy : uint8_t {
+        None,
+        Async,
+        Sync
+    };
+
+    /**
+     * \class MmapFileSink
+     * \brief File output that maps a preallocated segment and appends via
+     * memcpy, so steady-state logging performs zero write() syscalls.
+     *
+     * Segments are fixed-size files named \<base\>.0, \<base\>.1, ... with a
+     * page-sized header recording the committed payload length; the cursor in
+     * the header is updated after each append, so a crash leaves at most the
+     * last partially copied message uncommitted and recovery (or reopening
+     * the sink) resumes at — and readers trust only — the committed length.
+     * When a segment fills, the sink rotates to the next one automatically.
+     *
+     * \attention MmapFileSink performs no locking on its own; the owning Log
+     * instance serializes access to it.
+     */
+    class MmapFileSink {
+    public:
+        /**
+         * \brief Opens (or resumes) the newest segment for [p_base].
+         * \param p_base const std::filesystem::path& - segment files are
+         * created as \<base\>.N
+         * \param p_segment_size size_t - payload capacity per segment
+         * \param p_msync_policy MsyncPolicy
+         * \throws std::system_error if the segment can not be created or
+         * mapped.
+         */
+        explicit MmapFileSink(std::filesystem::path p_base, size_t p_segment_size = 16 * 1024 * 1024, MsyncPolicy p_msync_policy = MsyncPolicy::Async);
+
+        MmapFileSink(const MmapFileSink&) = delete;
+        MmapFileSink(MmapFileSink&&) = delete;
+        MmapFileSink& operator=(const MmapFileSink&) = delete;
+        MmapFileSink& operator=(MmapFileSink&&) = delete;
+
+        /**
+         * \brief Appends [p_message] to the current segment, rotating to a new
+         * one when it is full.
+         * \param p_message std::string_view
+         */
+        void write(std::string_view p_message);
+
+        /**
+         * \brief Applies the MsyncPolicy to the dirty part of the mapping.
+         */
+        void flush();
+
+        ~MmapFileSink();
+
+    private:
+        void openSegment();
+        void closeSegment();
+
+        std::filesystem::path m_base;
+        size_t m_segment_size;
+        MsyncPolicy m_msync_policy;
+        uint32_t m_segment_index{0};
+        int m_fd{-1};
+        char* m_map{nullptr};
+        std::atomic< uint64_t > m_cursor{0};
+    };
+
+}  // namespace mt::log
+
+#if defined(MT_LOG_HEADER_ONLY)
+  #include "mmap_file_sink.ipp"
+#endif
+
+#endif  // MT_MMAP_FILE_SINK_HPP
@@ -0,0 +1,192 @@
+/**
+ * \file mmap_file_sink.ipp
+ * \brief Out-of-line definitions for mmap_file_sink.hpp.
+ *
+ * Compiled once into the log library in the default build; included
+ * inline by the headers when MT_LOG_HEADER_ONLY is defined (the header-only
+ * CMake target does this), so short-lived tools can skip the library link.
+ */
+#ifndef MT_MMAP_FILE_SINK_IPP
+#define MT_MMAP_FILE_SINK_IPP
+
+#include "mmap_file_sink.hpp"
+
+#include <cstring>
+#include <system_error>
+
+#if (defined __linux) || (defined linux) || (defined __linux__) || (defined __OSX__) || (defined __APPLE__)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+#else
+  #define NOMINMAX
+  #include <windows.h>
+#endif
+
+
+#ifndef MT_LOG_FUNC
+  #if defined(MT_LOG_HEADER_ONLY)
+    #define MT_LOG_FUNC inline
+  #else
+    #define MT_LOG_FUNC
+  #endif
+#endif
+
+namespace mt::log {
+
+    namespace mmap_detail {
+
+        /**
+         * \internal
+         * \brief Page-sized segment header. [committed] is the number of payload
+         * bytes that were fully copied; anything past it is a torn tail to be
+         * ignored on recovery.
+         */
+        struct SegmentHeader {
+            char magic[8];
+            uint64_t committed;
+        };
+
+        inline constexpr char segment_magic[8] = {'M', 'T', 'L', 'O', 'G', 'S', 'E', 'G'};
+        inline constexpr size_t header_size = 4096;
+
+        [[noreturn]] MT_LOG_FUNC void throwErrno(const char* p_what) { throw std::system_error(errno, std::system_category(), p_what); }
+
+    }  // namespace mmap_detail
+
+    MT_LOG_FUNC MmapFileSink::MmapFileSink(std::filesystem::path p_base, const size_t p_segment_size, const MsyncPolicy p_msync_policy) :
+        m_base(std::move(p_base)),
+        m_segment_size(p_segment_size < 4096 ? 4096 : p_segment_size),
+        m_msync_policy(p_msync_policy) {
+        while (std::filesystem::exists(m_base.string() + "." + std::to_string(m_segment_index + 1))) {
+            ++m_segment_index;
+        }
+        openSegment();
+    }
+
+#if (defined __linux) || (defined linux) || (defined __linux__) || (defined __OSX__) || (defined __APPLE__)
+
+    MT_LOG_FUNC void MmapFileSink::openSegment() {
+        const auto segment_path = m_base.string() + "." + std::to_string(m_segment_index);
+        m_fd = ::open(segment_path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (m_fd < 0) {
+            mmap_detail::throwErrno("MmapFileSink: open");
+        }
+        const auto total_size = mmap_detail::header_size + m_segment_size;
+        if (::ftruncate(m_fd, static_cast< off_t >(total_size)) != 0) {
+            ::close(m_fd);
+            mmap_detail::throwErrno("MmapFileSink: ftruncate");
+        }
+        void* mapping = ::mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(m_fd);
+            mmap_detail::throwErrno("MmapFileSink: mmap");
+        }
+        m_map = static_cast< char* >(mapping);
+        auto* header = reinterpret_cast< mmap_detail::SegmentHeader* >(m_map);
+        if (std::memcmp(header->magic, mmap_detail::segment_magic, sizeof(mmap_detail::segment_magic)) == 0) {
+            m_cursor.store(header->committed <= m_segment_size ? header->committed : m_segment_size, std::memory_order_relaxed);
+        } else {
+            std::memcpy(header->magic, mmap_detail::segment_magic, sizeof(mmap_detail::segment_magic));
+            header->committed = 0;
+            m_cursor.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    MT_LOG_FUNC void MmapFileSink::closeSegment() {
+        if (m_map != nullptr) {
+            auto* header = reinterpret_cast< mmap_detail::SegmentHeader* >(m_map);
+            header->committed = m_cursor.load(std::memory_order_relaxed);
+            ::msync(m_map, mmap_detail::header_size + m_segment_size, MS_SYNC);
+            ::munmap(m_map, mmap_detail::header_size + m_segment_size);
+            m_map = nullptr;
+        }
+        if (m_fd >= 0) {
+            ::close(m_fd);
+            m_fd = -1;
+        }
+    }
+
+    MT_LOG_FUNC void MmapFileSink::flush() {
+        if (m_map == nullptr or m_msync_policy == MsyncPolicy::None) {
+            return;
+        }
+        ::msync(m_map, mmap_detail::header_size + m_cursor.load(std::memory_order_relaxed), m_msync_policy == MsyncPolicy::Sync ? MS_SYNC : MS_ASYNC);
+    }
+
+#else
+
+    MT_LOG_FUNC void MmapFileSink::openSegment() {
+        const auto segment_path = m_base.string() + "." + std::to_string(m_segment_index);
+        HANDLE file = CreateFileA(segment_path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::system_error(static_cast< int >(GetLastError()), std::system_category(), "MmapFileSink: CreateFile");
+        }
+        const auto total_size = static_cast< uint64_t >(mmap_detail::header_size + m_segment_size);
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast< DWORD >(total_size >> 32), static_cast< DWORD >(total_size), nullptr);
+        if (mapping == nullptr) {
+            CloseHandle(file);
+            throw std::system_error(static_cast< int >(GetLastError()), std::system_category(), "MmapFileSink: CreateFileMapping");
+        }
+        void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, total_size);
+        CloseHandle(mapping);
+        if (view == nullptr) {
+            CloseHandle(file);
+            throw std::system_error(static_cast< int >(GetLastError()), std::system_category(), "MmapFileSink: MapViewOfFile");
+        }
+        m_fd = static_cast< int >(reinterpret_cast< intptr_t >(file));
+        m_map = static_cast< char* >(view);
+        auto* header = reinterpret_cast< mmap_detail::SegmentHeader* >(m_map);
+        if (std::memcmp(header->magic, mmap_detail::segment_magic, sizeof(mmap_detail::segment_magic)) == 0) {
+            m_cursor.store(header->committed <= m_segment_size ? header->committed : m_segment_size, std::memory_order_relaxed);
+        } else {
+            std::memcpy(header->magic, mmap_detail::segment_magic, sizeof(mmap_detail::segment_magic));
+            header->committed = 0;
+            m_cursor.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    MT_LOG_FUNC void MmapFileSink::closeSegment() {
+        if (m_map != nullptr) {
+            auto* header = reinterpret_cast< mmap_detail::SegmentHeader* >(m_map);
+            header->committed = m_cursor.load(std::memory_order_relaxed);
+            FlushViewOfFile(m_map, 0);
+            UnmapViewOfFile(m_map);
+            m_map = nullptr;
+        }
+        if (m_fd >= 0) {
+            CloseHandle(reinterpret_cast< HANDLE >(static_cast< intptr_t >(m_fd)));
+            m_fd = -1;
+        }
+    }
+
+    MT_LOG_FUNC void MmapFileSink::flush() {
+        if (m_map == nullptr or m_msync_policy == MsyncPolicy::None) {
+            return;
+        }
+        FlushViewOfFile(m_map, mmap_detail::header_size + m_cursor.load(std::memory_order_relaxed));
+    }
+
+#endif
+
+    MT_LOG_FUNC void MmapFileSink::write(const std::string_view p_message) {
+        if (p_message.size() > m_segment_size) {
+            return;
+        }
+        auto cursor = m_cursor.load(std::memory_order_relaxed);
+        if (cursor + p_message.size() > m_segment_size) {
+            closeSegment();
+            ++m_segment_index;
+            openSegment();
+            cursor = m_cursor.load(std::memory_order_relaxed);
+        }
+        std::memcpy(m_map + mmap_detail::header_size + cursor, p_message.data(), p_message.size());
+        m_cursor.store(cursor + p_message.size(), std::memory_order_release);
+        reinterpret_cast< mmap_detail::SegmentHeader* >(m_map)->committed = cursor + p_message.size();
+    }
+
+    MT_LOG_FUNC MmapFileSink::~MmapFileSink() { closeSegment(); }
+
+}  // namespace mt::log
+
+#endif  // MT_MMAP_FILE_SINK_IPP
@@ -0,0 +1,132 @@
+#ifndef MT_MPSC_RING_HPP
+#define MT_MPSC_RING_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <utility>
+
+namespace mt::log {
+
+    /**
+     * \brief Destructive interference distance used for padding. A fixed value
+     * keeps the layout ABI-stable across compiler versions and -mtune flags
+     * (GCC warns about std::hardware_destructive_interference_size for exactly
+     * that reason); 64 bytes covers every platform the library targets.
+     */
+    inline constexpr size_t cache_line_size = 64;
+
+    /**
+     * \class MpscRing
+     * \brief Bounded lock-free ring buffer used as the producer-side hand-off
+     * between Log::write() callers and the writer thread.
+     *
+     * The design is the classic bounded queue with per-slot sequence numbers:
+     * capacity is rounded up to a power of two, producers claim slots by
+     * advancing the enqueue cursor with a CAS, and each slot's sequence number
+     * tells producers and the consumer whether the slot is free or filled
+     * without any shared lock. Enqueue and dequeue cursors live on separate
+     * cache lines so contending producers do not false-share with the
+     * consumer.
+     *
+     * The slot protocol also admits pops from a producer thread, which the
+     * OverflowPolicy::DropOldest path relies on to discard the oldest pending
+     * event when the ring is full.
+     */
+    template < class T > class MpscRing {
+    public:
+        explicit MpscRing(const size_t p_capacity) :
+            m_mask(std::bit_ceil(p_capacity < 2 ? size_t{2} : p_capacity) - 1),
+            m_slots(std::make_unique< Slot[] >(m_mask + 1)) {
+            for (size_t i = 0; i <= m_mask; ++i) {
+                m_slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpscRing(const MpscRing&) = delete;
+        MpscRing(MpscRing&&) = delete;
+        MpscRing& operator=(const MpscRing&) = delete;
+        MpscRing& operator=(MpscRing&&) = delete;
+
+        ~MpscRing() {
+            while (tryPop().has_value()) { }
+        }
+
+        /**
+         * \brief Attempts to enqueue an element.
+         *
+         * [p_value] is moved from only when the push succeeds.
+         *
+         * \param p_value T&&
+         * \return false if the ring is full, true otherwise.
+         */
+        auto tryPush(T&& p_value) -> bool {
+            auto l_pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            for (;;) {
+                Slot& l_slot = m_slots[l_pos & m_mask];
+                const auto l_sequence = l_slot.sequence.load(std::memory_order_acquire);
+                const auto l_difference = static_cast< intptr_t >(l_sequence) - static_cast< intptr_t >(l_pos);
+                if (l_difference == 0) {
+                    if (m_enqueue_pos.compare_exchange_weak(l_pos, l_pos + 1, std::memory_order_relaxed)) {
+                        new (l_slot.storage) T(std::move(p_value));
+                        l_slot.sequence.store(l_pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (l_difference < 0) {
+                    return false;
+                } else {
+                    l_pos = m_enqueue_pos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * \brief Attempts to dequeue the oldest element.
+         * \return std::nullopt if the ring is empty.
+         */
+        auto tryPop() -> std::optional< T > {
+            auto l_pos = m_dequeue_pos.load(std::memory_order_relaxed);
+            for (;;) {
+                Slot& l_slot = m_slots[l_pos & m_mask];
+                const auto l_sequence = l_slot.sequence.load(std::memory_order_acquire);
+                const auto l_difference = static_cast< intptr_t >(l_sequence) - static_cast< intptr_t >(l_pos + 1);
+                if (l_difference == 0) {
+                    if (m_dequeue_pos.compare_exchange_weak(l_pos, l_pos + 1, std::memory_order_relaxed)) {
+                        T* l_stored = std::launder(reinterpret_cast< T* >(l_slot.storage));
+                        std::optional< T > l_result{std::move(*l_stored)};
+                        l_stored->~T();
+                        l_slot.sequence.store(l_pos + m_mask + 1, std::memory_order_release);
+                        return l_result;
+                    }
+                } else if (l_difference < 0) {
+                    return std::nullopt;
+                } else {
+                    l_pos = m_dequeue_pos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        [[nodiscard]] auto empty() const -> bool {
+            return m_dequeue_pos.load(std::memory_order_acquire) == m_enqueue_pos.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] auto capacity() const -> size_t { return m_mask + 1; }
+
+    private:
+        struct Slot {
+            std::atomic< size_t > sequence;
+            alignas(T) std::byte storage[sizeof(T)];
+        };
+
+        size_t m_mask;
+        std::unique_ptr< Slot[] > m_slots;
+        alignas(cache_line_size) std::atomic< size_t > m_enqueue_pos{0};
+        alignas(cache_line_size) std::atomic< size_t > m_dequeue_pos{0};
+    };
+
+}  // namespace mt::log
+
+#endif  // MT_MPSC_RING_HPP
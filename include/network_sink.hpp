@@ -0,0 +1,144 @@
+#ifndef MT_NETWORK_SINK_HPP
+#define MT_NETWORK_SINK_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace mt::log {
+
+    /**
+     * \brief Transport of a NetworkSink connection.
+     */
+    enum class NetworkTransport : uint8_t { UDP, TCP, Unix };
+
+    /**
+     * \struct NetworkOptions
+     * \brief Batching, queueing and reconnect tuning for a NetworkSink.
+     */
+    struct NetworkOptions {
+        size_t batch_bytes{1400};
+        std::chrono::milliseconds linger{std::chrono::milliseconds(10)};
+        size_t queue_capacity{1024};
+        bool compress{false};
+        std::chrono::milliseconds reconnect_initial{std::chrono::milliseconds(100)};
+        std::chrono::milliseconds reconnect_max{std::chrono::milliseconds(5000)};
+    };
+
+    /**
+     * \class NetworkSink
+     * \brief Ships formatted log lines to a remote collector without ever
+     * blocking the logging thread on the network.
+     *
+     * write() appends the line straight into the open batch frame — one
+     * append, no per-message string or re-copy — and seals the frame once it
+     * reaches NetworkOptions::batch_bytes (or the linger deadline passes, or
+     * flush() is called). Sealed frames move by value into a bounded send
+     * queue drained by a background sender thread, so TCP backpressure and
+     * collector restarts are absorbed there: the sender reconnects with
+     * exponential backoff while frames queue up, and frames beyond the queue
+     * capacity are dropped and counted rather than stalling producers.
+     *
+     * On stream transports (TCP, Unix) every frame is length-prefixed —
+     * [uint32_t length][uint8_t flags][payload] — so the collector can
+     * delimit batches; on UDP one frame becomes one [uint8_t flags][payload]
+     * datagram, so batch_bytes should stay within the path MTU. Flag bit 0
+     * marks a deflate-compressed payload; compression requires a build with
+     * zlib (MT_LOG_HAVE_ZLIB) and is ignored otherwise.
+     */
+    class NetworkSink {
+    public:
+        /**
+         * \brief Creates a sink sending to [p_host]:[p_port] over [p_transport]
+         * (NetworkTransport::UDP or NetworkTransport::TCP).
+         *
+         * The constructor does not connect; the sender thread establishes the
+         * connection and keeps retrying with backoff, so the sink can be
+         * created before the collector is up.
+         *
+         * \param p_transport NetworkTransport
+         * \param p_host std::string - hostname or address literal.
+         * \param p_port uint16_t
+         * \param p_options NetworkOptions
+         */
+        NetworkSink(NetworkTransport p_transport, std::string p_host, uint16_t p_port, NetworkOptions p_options = {});
+
+        /**
+         * \brief Creates a sink sending to the Unix-domain stream socket at
+         * [p_socket_path]. Not available on Windows.
+         * \param p_socket_path std::string
+         * \param p_options NetworkOptions
+         */
+        explicit NetworkSink(std::string p_socket_path, NetworkOptions p_options = {});
+
+        NetworkSink(const NetworkSink& other) = delete;
+        NetworkSink(NetworkSink&& other) = delete;
+        NetworkSink& operator=(const NetworkSink& other) = delete;
+        NetworkSink& operator=(NetworkSink&& other) = delete;
+
+        /**
+         * \brief Flushes what is queued, stops the sender thread and closes
+         * the socket. Frames that cannot be delivered within the backoff
+         * schedule at shutdown are dropped.
+         */
+        ~NetworkSink();
+
+        /**
+         * \brief Appends one formatted line to the open batch frame. Never
+         * touches the network; cost is one append plus, at a frame boundary,
+         * one move into the send queue.
+         * \param p_message std::string_view
+         */
+        void write(std::string_view p_message);
+
+        /**
+         * \brief Seals the open frame and blocks until the send queue has
+         * drained (delivered or dropped).
+         */
+        void flush();
+
+        /**
+         * \brief Frames dropped on a full send queue since construction.
+         */
+        [[nodiscard]] auto droppedFrames() const -> uint64_t { return m_dropped_frames.load(std::memory_order_relaxed); }
+
+    private:
+        void startSender();
+        void sealFrameLocked();
+        void senderLoop();
+        [[nodiscard]] auto openSocket() -> bool;
+        void closeSocket();
+        [[nodiscard]] auto sendFrame(const std::string& p_frame) -> bool;
+
+        NetworkTransport m_transport;
+        std::string m_host;
+        uint16_t m_port{0};
+        NetworkOptions m_options;
+
+        std::mutex m_mutex;
+        std::condition_variable m_sender_wakeup;
+        std::condition_variable m_drained;
+        std::string m_frame;
+        std::chrono::steady_clock::time_point m_frame_opened{};
+        std::deque< std::string > m_pending;
+        bool m_sending{false};
+        bool m_stop{false};
+        std::atomic< uint64_t > m_dropped_frames{0};
+
+        std::thread m_sender;
+        intptr_t m_socket{-1};
+    };
+
+}  // namespace mt::log
+
+#if defined(MT_LOG_HEADER_ONLY)
+  #include "network_sink.ipp"
+#endif
+
+#endif  // MT_NETWORK_SINK_HPP
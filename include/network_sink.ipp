@@ -0,0 +1,327 @@
+/**
+ * \file network_sink.ipp
+ * \brief Out-of-line definitions for network_sink.hpp.
+ *
+ * Compiled once into the log library in the default build; included
+ * inline by the headers when MT_LOG_HEADER_ONLY is defined (the header-only
+ * CMake target does this), so short-lived tools can skip the library link.
+ */
+#ifndef MT_NETWORK_SINK_IPP
+#define MT_NETWORK_SINK_IPP
+
+#include "network_sink.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#if (defined __linux) || (defined linux) || (defined __linux__) || (defined __OSX__) || (defined __APPLE__)
+  #include <netdb.h>
+  #include <netinet/in.h>
+  #include <sys/socket.h>
+  #include <sys/un.h>
+  #include <unistd.h>
+#else
+  #define NOMINMAX
+  #include <winsock2.h>
+  #include <ws2tcpip.h>
+#endif
+
+#if defined(MT_LOG_HAVE_ZLIB)
+  #include <zlib.h>
+#endif
+
+
+#ifndef MT_LOG_FUNC
+  #if defined(MT_LOG_HEADER_ONLY)
+    #define MT_LOG_FUNC inline
+  #else
+    #define MT_LOG_FUNC
+  #endif
+#endif
+
+namespace mt::log {
+
+    namespace network_detail {
+
+        inline constexpr uint8_t frame_flag_compressed = 0x01;
+        inline constexpr intptr_t invalid_socket = -1;
+
+#if (defined __linux) || (defined linux) || (defined __linux__) || (defined __OSX__) || (defined __APPLE__)
+
+        MT_LOG_FUNC void closeNativeSocket(const intptr_t p_socket) { ::close(static_cast< int >(p_socket)); }
+
+        MT_LOG_FUNC auto sendAll(const intptr_t p_socket, const char* p_data, size_t p_length) -> bool {
+            while (p_length > 0) {
+  #if (defined __linux) || (defined linux) || (defined __linux__)
+                const auto sent = ::send(static_cast< int >(p_socket), p_data, p_length, MSG_NOSIGNAL);
+  #else
+                const auto sent = ::send(static_cast< int >(p_socket), p_data, p_length, 0);
+  #endif
+                if (sent <= 0) {
+                    return false;
+                }
+                p_data += sent;
+                p_length -= static_cast< size_t >(sent);
+            }
+            return true;
+        }
+
+#else
+
+        MT_LOG_FUNC void ensureWinsock() {
+            static const int startup = []() -> int {
+                WSADATA data;
+                return WSAStartup(MAKEWORD(2, 2), &data);
+            }();
+            static_cast< void >(startup);
+        }
+
+        MT_LOG_FUNC void closeNativeSocket(const intptr_t p_socket) { ::closesocket(static_cast< SOCKET >(p_socket)); }
+
+        MT_LOG_FUNC auto sendAll(const intptr_t p_socket, const char* p_data, size_t p_length) -> bool {
+            while (p_length > 0) {
+                const auto sent = ::send(static_cast< SOCKET >(p_socket), p_data, static_cast< int >(p_length), 0);
+                if (sent <= 0) {
+                    return false;
+                }
+                p_data += sent;
+                p_length -= static_cast< size_t >(sent);
+            }
+            return true;
+        }
+
+#endif
+
+        /**
+         * \internal
+         * \brief Deflates [p_payload] in place when the build has zlib and the
+         * result is actually smaller; returns whether the payload is now
+         * compressed.
+         */
+        MT_LOG_FUNC auto compressPayload([[maybe_unused]] std::string& p_payload) -> bool {
+#if defined(MT_LOG_HAVE_ZLIB)
+            auto bound = compressBound(static_cast< uLong >(p_payload.size()));
+            std::vector< char > compressed(bound);
+            if (compress2(reinterpret_cast< Bytef* >(compressed.data()), &bound, reinterpret_cast< const Bytef* >(p_payload.data()),
+                          static_cast< uLong >(p_payload.size()), Z_BEST_SPEED) != Z_OK
+                or bound >= p_payload.size()) {
+                return false;
+            }
+            p_payload.assign(compressed.data(), bound);
+            return true;
+#else
+            return false;
+#endif
+        }
+
+    }  // namespace network_detail
+
+    MT_LOG_FUNC NetworkSink::NetworkSink(const NetworkTransport p_transport, std::string p_host, const uint16_t p_port, NetworkOptions p_options) :
+        m_transport(p_transport),
+        m_host(std::move(p_host)),
+        m_port(p_port),
+        m_options(p_options) {
+        if (p_transport == NetworkTransport::Unix) {
+            throw std::invalid_argument("NetworkSink: Unix transport takes a socket path, use the path constructor");
+        }
+        startSender();
+    }
+
+    MT_LOG_FUNC NetworkSink::NetworkSink(std::string p_socket_path, NetworkOptions p_options) :
+        m_transport(NetworkTransport::Unix),
+        m_host(std::move(p_socket_path)),
+        m_options(p_options) {
+        startSender();
+    }
+
+    MT_LOG_FUNC NetworkSink::~NetworkSink() {
+        {
+            std::scoped_lock lock(m_mutex);
+            sealFrameLocked();
+            m_stop = true;
+        }
+        m_sender_wakeup.notify_all();
+        if (m_sender.joinable()) {
+            m_sender.join();
+        }
+        closeSocket();
+    }
+
+    MT_LOG_FUNC void NetworkSink::write(const std::string_view p_message) {
+        std::scoped_lock lock(m_mutex);
+        if (m_frame.empty()) {
+            m_frame_opened = std::chrono::steady_clock::now();
+        }
+        m_frame += p_message;
+        if (m_frame.size() >= m_options.batch_bytes) {
+            sealFrameLocked();
+            m_sender_wakeup.notify_one();
+        }
+    }
+
+    MT_LOG_FUNC void NetworkSink::flush() {
+        std::unique_lock lock(m_mutex);
+        sealFrameLocked();
+        m_sender_wakeup.notify_one();
+        m_drained.wait(lock, [this]() -> bool { return m_pending.empty() and not m_sending; });
+    }
+
+    MT_LOG_FUNC void NetworkSink::startSender() {
+        m_sender = std::thread([this]() -> void { senderLoop(); });
+    }
+
+    MT_LOG_FUNC void NetworkSink::sealFrameLocked() {
+        if (m_frame.empty()) {
+            return;
+        }
+        if (m_pending.size() >= m_options.queue_capacity) {
+            m_dropped_frames.fetch_add(1, std::memory_order_relaxed);
+            m_frame.clear();
+            return;
+        }
+        m_pending.push_back(std::move(m_frame));
+        m_frame.clear();
+    }
+
+    MT_LOG_FUNC void NetworkSink::senderLoop() {
+        auto backoff = m_options.reconnect_initial;
+        std::unique_lock lock(m_mutex);
+        for (;;) {
+            m_sender_wakeup.wait_for(lock, m_options.linger, [this]() -> bool { return not m_pending.empty() or m_stop; });
+            if (m_pending.empty() and not m_frame.empty() and std::chrono::steady_clock::now() - m_frame_opened >= m_options.linger) {
+                sealFrameLocked();
+            }
+            if (m_pending.empty()) {
+                if (m_stop) {
+                    return;
+                }
+                continue;
+            }
+            auto frame = std::move(m_pending.front());
+            m_pending.pop_front();
+            m_sending = true;
+            lock.unlock();
+
+            if (m_options.compress and network_detail::compressPayload(frame)) {
+                frame.insert(0, 1, static_cast< char >(network_detail::frame_flag_compressed));
+            } else {
+                frame.insert(0, 1, '\0');
+            }
+            while (not sendFrame(frame)) {
+                closeSocket();
+                {
+                    std::unique_lock retry_lock(m_mutex);
+                    if (m_stop) {
+                        m_dropped_frames.fetch_add(1 + m_pending.size(), std::memory_order_relaxed);
+                        m_pending.clear();
+                        m_sending = false;
+                        m_drained.notify_all();
+                        return;
+                    }
+                }
+                std::this_thread::sleep_for(backoff);
+                backoff = std::min(backoff * 2, m_options.reconnect_max);
+            }
+            backoff = m_options.reconnect_initial;
+
+            lock.lock();
+            m_sending = false;
+            if (m_pending.empty()) {
+                m_drained.notify_all();
+            }
+        }
+    }
+
+    /**
+     * \internal
+     * \brief Delivers one sealed frame, connecting first if necessary. The
+     * frame arrives with its flags byte already prepended; stream transports
+     * additionally get the uint32_t payload length in front, UDP sends the
+     * frame as a single datagram.
+     */
+    MT_LOG_FUNC auto NetworkSink::sendFrame(const std::string& p_frame) -> bool {
+        if (m_socket == network_detail::invalid_socket and not openSocket()) {
+            return false;
+        }
+        if (m_transport == NetworkTransport::UDP) {
+            return network_detail::sendAll(m_socket, p_frame.data(), p_frame.size());
+        }
+        const auto length = static_cast< uint32_t >(p_frame.size() - 1);
+        char header[sizeof(length)];
+        std::memcpy(header, &length, sizeof(length));
+        return network_detail::sendAll(m_socket, header, sizeof(header)) and network_detail::sendAll(m_socket, p_frame.data(), p_frame.size());
+    }
+
+    MT_LOG_FUNC auto NetworkSink::openSocket() -> bool {
+#if (defined __linux) || (defined linux) || (defined __linux__) || (defined __OSX__) || (defined __APPLE__)
+        if (m_transport == NetworkTransport::Unix) {
+            sockaddr_un address {};
+            address.sun_family = AF_UNIX;
+            if (m_host.size() >= sizeof(address.sun_path)) {
+                return false;
+            }
+            std::memcpy(address.sun_path, m_host.c_str(), m_host.size() + 1);
+            const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd < 0) {
+                return false;
+            }
+            if (::connect(fd, reinterpret_cast< const sockaddr* >(&address), sizeof(address)) != 0) {
+                ::close(fd);
+                return false;
+            }
+            m_socket = fd;
+            return true;
+        }
+#else
+        network_detail::ensureWinsock();
+        if (m_transport == NetworkTransport::Unix) {
+            return false;
+        }
+#endif
+        addrinfo hints {};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = m_transport == NetworkTransport::UDP ? SOCK_DGRAM : SOCK_STREAM;
+        addrinfo* results = nullptr;
+        const auto port = std::to_string(m_port);
+        if (::getaddrinfo(m_host.c_str(), port.c_str(), &hints, &results) != 0) {
+            return false;
+        }
+        for (const addrinfo* entry = results; entry != nullptr; entry = entry->ai_next) {
+            const auto fd = ::socket(entry->ai_family, entry->ai_socktype, entry->ai_protocol);
+#if (defined __linux) || (defined linux) || (defined __linux__) || (defined __OSX__) || (defined __APPLE__)
+            if (fd < 0) {
+                continue;
+            }
+            if (::connect(fd, entry->ai_addr, static_cast< socklen_t >(entry->ai_addrlen)) == 0) {
+                m_socket = fd;
+                ::freeaddrinfo(results);
+                return true;
+            }
+            ::close(fd);
+#else
+            if (fd == INVALID_SOCKET) {
+                continue;
+            }
+            if (::connect(fd, entry->ai_addr, static_cast< int >(entry->ai_addrlen)) == 0) {
+                m_socket = static_cast< intptr_t >(fd);
+                ::freeaddrinfo(results);
+                return true;
+            }
+            ::closesocket(fd);
+#endif
+        }
+        ::freeaddrinfo(results);
+        return false;
+    }
+
+    MT_LOG_FUNC void NetworkSink::closeSocket() {
+        if (m_socket != network_detail::invalid_socket) {
+            network_detail::closeNativeSocket(m_socket);
+            m_socket = network_detail::invalid_socket;
+        }
+    }
+
+}  // namespace mt::log
+
+#endif  // MT_NETWORK_SINK_IPP
@@ -0,0 +1,139 @@
+#ifndef MT_PAYLOAD_POOL_HPP
+#define MT_PAYLOAD_POOL_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace mt::log {
+
+    /**
+     * \class PayloadPool
+     * \brief Fixed-size chunk pool backing message payloads that exceed the
+     * MessageBuffer inline capacity.
+     *
+     * Long messages are allocated on the producer thread and freed on the
+     * writer thread after the event is written — a cross-thread malloc/free
+     * pattern that fragments and contends in the global allocator. The pool
+     * preallocates a contiguous block of equal-sized chunks and recycles them
+     * through a lock-free index-based free list (a version tag in the upper
+     * bits of the head guards against ABA). When the pool is exhausted the
+     * caller falls back to the heap; occupancy and fallback counts are
+     * observable through stats() so the pool can be sized from production
+     * numbers.
+     */
+    class PayloadPool {
+    public:
+        static constexpr size_t chunk_size = 1024;
+        static constexpr uint32_t chunk_count = 256;
+
+        /**
+         * \struct Stats
+         * \brief Point-in-time pool occupancy snapshot.
+         */
+        struct Stats {
+            uint32_t chunks{chunk_count};
+            uint32_t in_use{0};
+            uint32_t high_water{0};
+            uint64_t heap_fallbacks{0};
+        };
+
+        static auto instance() -> PayloadPool& {
+            static PayloadPool pool;
+            return pool;
+        }
+
+        /**
+         * \brief Takes a chunk from the free list.
+         * \param p_size size_t
+         * \return nullptr if [p_size] exceeds chunk_size or the pool is
+         * exhausted; the caller is expected to fall back to the heap.
+         */
+        auto acquire(const size_t p_size) -> char* {
+            if (p_size > chunk_size) {
+                return nullptr;
+            }
+            auto l_head = m_head.load(std::memory_order_acquire);
+            uint32_t l_index;
+            for (;;) {
+                l_index = static_cast< uint32_t >(l_head);
+                if (l_index == npos) {
+                    m_heap_fallbacks.fetch_add(1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+                const uint64_t l_new_head = (((l_head >> 32) + 1) << 32) | m_next[l_index].load(std::memory_order_relaxed);
+                if (m_head.compare_exchange_weak(l_head, l_new_head, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    break;
+                }
+            }
+            const auto l_in_use = m_in_use.fetch_add(1, std::memory_order_relaxed) + 1;
+            auto l_high_water = m_high_water.load(std::memory_order_relaxed);
+            while (l_in_use > l_high_water and not m_high_water.compare_exchange_weak(l_high_water, l_in_use, std::memory_order_relaxed)) { }
+            return m_storage.get() + static_cast< size_t >(l_index) * chunk_size;
+        }
+
+        /**
+         * \brief Returns a chunk obtained from acquire() to the free list.
+         * Safe to call from a different thread than the one that acquired it.
+         * \param p_chunk char*
+         */
+        void release(char* p_chunk) {
+            const auto l_index = static_cast< uint32_t >((p_chunk - m_storage.get()) / chunk_size);
+            auto l_head = m_head.load(std::memory_order_acquire);
+            for (;;) {
+                m_next[l_index].store(static_cast< uint32_t >(l_head), std::memory_order_relaxed);
+                const uint64_t l_new_head = (((l_head >> 32) + 1) << 32) | l_index;
+                if (m_head.compare_exchange_weak(l_head, l_new_head, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    break;
+                }
+            }
+            m_in_use.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * \brief Checks whether [p_pointer] lies inside the pool's storage.
+         */
+        [[nodiscard]] auto owns(const char* p_pointer) const -> bool {
+            return p_pointer >= m_storage.get() and p_pointer < m_storage.get() + static_cast< size_t >(chunk_count) * chunk_size;
+        }
+
+        [[nodiscard]] auto stats() const -> Stats {
+            Stats l_stats;
+            l_stats.in_use = m_in_use.load(std::memory_order_relaxed);
+            l_stats.high_water = m_high_water.load(std::memory_order_relaxed);
+            l_stats.heap_fallbacks = m_heap_fallbacks.load(std::memory_order_relaxed);
+            return l_stats;
+        }
+
+    private:
+        static constexpr uint32_t npos = UINT32_MAX;
+
+        PayloadPool() :
+            m_storage(std::make_unique< char[] >(static_cast< size_t >(chunk_count) * chunk_size)),
+            m_next(std::make_unique< std::atomic< uint32_t >[] >(chunk_count)) {
+            for (uint32_t i = 0; i < chunk_count - 1; ++i) {
+                m_next[i].store(i + 1, std::memory_order_relaxed);
+            }
+            m_next[chunk_count - 1].store(npos, std::memory_order_relaxed);
+            m_head.store(0, std::memory_order_release);
+        }
+
+        std::unique_ptr< char[] > m_storage;
+        /**
+         * \internal
+         * \brief Free-list links. Atomic with relaxed ordering — same codegen
+         * as plain loads and stores, but a link can be read in acquire()
+         * under a head that release() is concurrently relinking, which would
+         * otherwise be a formal data race; the versioned head CAS discards
+         * such stale reads.
+         */
+        std::unique_ptr< std::atomic< uint32_t >[] > m_next;
+        std::atomic< uint64_t > m_head{static_cast< uint64_t >(npos)};
+        std::atomic< uint32_t > m_in_use{0};
+        std::atomic< uint32_t > m_high_water{0};
+        std::atomic< uint64_t > m_heap_fallbacks{0};
+    };
+
+}  // namespace mt::log
+
+#endif  // MT_PAYLOAD_POOL_HPP
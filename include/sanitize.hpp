@@ -0,0 +1,121 @@
+#ifndef MT_SANITIZE_HPP
+#define MT_SANITIZE_HPP
+
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+  #include <immintrin.h>
+#elif defined(__ARM_NEON)
+  #include <arm_neon.h>
+#endif
+
+namespace mt::log {
+
+    /**
+     * \brief Escapes one unsafe byte into [p_out].
+     *
+     * The common control characters get their two-character C escapes; every
+     * other control byte (and DEL) becomes \\xNN. Backslash itself is doubled
+     * so escaped output stays unambiguous.
+     */
+    inline void appendEscapedByte(std::string& p_out, const unsigned char p_byte) {
+        switch (p_byte) {
+            case '\n' : p_out += "\\n"; break;
+            case '\r' : p_out += "\\r"; break;
+            case '\t' : p_out += "\\t"; break;
+            case '\\' : p_out += "\\\\"; break;
+            default : {
+                constexpr char hex_digits[] = "0123456789abcdef";
+                const char l_escape[4] = {'\\', 'x', hex_digits[p_byte >> 4], hex_digits[p_byte & 0x0F]};
+                p_out.append(l_escape, sizeof(l_escape));
+            }
+        }
+    }
+
+    /**
+     * \brief Index of the first byte in [p_data, p_size) that needs escaping
+     * — control characters, DEL or backslash — or npos when the buffer is
+     * clean.
+     *
+     * The scan is vectorized (AVX2, SSE2 or NEON, whichever the build
+     * targets) with a scalar tail; since most messages contain nothing to
+     * escape, the whole sanitization pass usually reduces to this scan plus
+     * one append.
+     */
+    inline auto findUnsafeByte(const char* p_data, const size_t p_size) -> size_t {
+        constexpr size_t npos = static_cast< size_t >(-1);
+        size_t i = 0;
+#if defined(__AVX2__)
+        const __m256i l_limit = _mm256_set1_epi8(0x1F);
+        const __m256i l_backslash = _mm256_set1_epi8('\\');
+        const __m256i l_del = _mm256_set1_epi8(0x7F);
+        for (; i + 32 <= p_size; i += 32) {
+            const __m256i l_chunk = _mm256_loadu_si256(reinterpret_cast< const __m256i* >(p_data + i));
+            const __m256i l_control = _mm256_cmpeq_epi8(_mm256_min_epu8(l_chunk, l_limit), l_chunk);
+            const __m256i l_unsafe =
+                _mm256_or_si256(_mm256_or_si256(l_control, _mm256_cmpeq_epi8(l_chunk, l_backslash)), _mm256_cmpeq_epi8(l_chunk, l_del));
+            const auto l_mask = static_cast< uint32_t >(_mm256_movemask_epi8(l_unsafe));
+            if (l_mask != 0) {
+                return i + std::countr_zero(l_mask);
+            }
+        }
+#elif defined(__SSE2__)
+        const __m128i l_limit = _mm_set1_epi8(0x1F);
+        const __m128i l_backslash = _mm_set1_epi8('\\');
+        const __m128i l_del = _mm_set1_epi8(0x7F);
+        for (; i + 16 <= p_size; i += 16) {
+            const __m128i l_chunk = _mm_loadu_si128(reinterpret_cast< const __m128i* >(p_data + i));
+            const __m128i l_control = _mm_cmpeq_epi8(_mm_min_epu8(l_chunk, l_limit), l_chunk);
+            const __m128i l_unsafe = _mm_or_si128(_mm_or_si128(l_control, _mm_cmpeq_epi8(l_chunk, l_backslash)), _mm_cmpeq_epi8(l_chunk, l_del));
+            const auto l_mask = static_cast< uint32_t >(_mm_movemask_epi8(l_unsafe));
+            if (l_mask != 0) {
+                return i + std::countr_zero(l_mask);
+            }
+        }
+#elif defined(__ARM_NEON)
+        for (; i + 16 <= p_size; i += 16) {
+            const uint8x16_t l_chunk = vld1q_u8(reinterpret_cast< const uint8_t* >(p_data + i));
+            const uint8x16_t l_unsafe = vorrq_u8(vorrq_u8(vcltq_u8(l_chunk, vdupq_n_u8(0x20)), vceqq_u8(l_chunk, vdupq_n_u8('\\'))),
+                                                 vceqq_u8(l_chunk, vdupq_n_u8(0x7F)));
+            if (vmaxvq_u8(l_unsafe) != 0) {
+                break;
+            }
+        }
+#endif
+        for (; i < p_size; ++i) {
+            const auto l_byte = static_cast< unsigned char >(p_data[i]);
+            if (l_byte < 0x20 or l_byte == 0x7F or l_byte == '\\') {
+                return i;
+            }
+        }
+        return npos;
+    }
+
+    /**
+     * \brief Appends [p_message] to [p_out] with unsafe bytes escaped, in a
+     * single pass.
+     *
+     * Clean stretches between unsafe bytes are appended in bulk; a message
+     * with nothing to escape costs one vectorized scan and one append.
+     */
+    inline void sanitizeAppend(std::string& p_out, const std::string_view p_message) {
+        constexpr size_t npos = static_cast< size_t >(-1);
+        size_t l_position = 0;
+        while (l_position < p_message.size()) {
+            const auto l_unsafe = findUnsafeByte(p_message.data() + l_position, p_message.size() - l_position);
+            if (l_unsafe == npos) {
+                p_out.append(p_message.data() + l_position, p_message.size() - l_position);
+                return;
+            }
+            p_out.append(p_message.data() + l_position, l_unsafe);
+            appendEscapedByte(p_out, static_cast< unsigned char >(p_message[l_position + l_unsafe]));
+            l_position += l_unsafe + 1;
+        }
+    }
+
+}  // namespace mt::log
+
+#endif  // MT_SANITIZE_HPP
@@ -0,0 +1,137 @@
+#ifndef MT_SHM_CHANNEL_HPP
+#define MT_SHM_CHANNEL_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "file_sink.hpp"
+
+namespace mt::log {
+
+    /**
+     * \class ShmChannelProducer
+     * \brief Producer end of a shared-memory log channel shared by several
+     * processes.
+     *
+     * The channel is a named shared-memory segment holding a fixed number of
+     * per-process single-producer rings plus one shared sequence counter.
+     * write() stamps the record with the next sequence number and appends it
+     * to this process's own ring — no cross-process lock is taken, unlike the
+     * IPCMutex path which serializes every process on a file mutex around an
+     * open/write/close cycle. A single ShmChannelCollector merges the rings
+     * by sequence number and performs the file I/O, so the channel yields one
+     * writer and globally ordered output.
+     *
+     * The first process to attach initializes the segment; both ends must be
+     * built with the same slot_count and slot_capacity. A full ring drops the
+     * record rather than blocking the producer; drops are counted per slot
+     * and reported by the collector's stats.
+     */
+    class ShmChannelProducer {
+    public:
+        static constexpr uint32_t slot_count = 16;
+        static constexpr size_t slot_capacity = 1 << 20;
+
+        /**
+         * \brief Attaches to (creating if necessary) the channel [p_name] and
+         * claims a producer slot for this process.
+         * \param p_name const std::string& - shared-memory object name, e.g.
+         * "/myapp-log".
+         */
+        explicit ShmChannelProducer(const std::string& p_name);
+
+        ShmChannelProducer(const ShmChannelProducer& other) = delete;
+        ShmChannelProducer(ShmChannelProducer&& other) = delete;
+        ShmChannelProducer& operator=(const ShmChannelProducer& other) = delete;
+        ShmChannelProducer& operator=(ShmChannelProducer&& other) = delete;
+
+        ~ShmChannelProducer();
+
+        /**
+         * \brief Appends one formatted record to this process's ring.
+         *
+         * The caller is expected to serialize concurrent calls (Log holds its
+         * instance mutex around the write). Records that do not fit into the
+         * ring's free space are dropped and counted.
+         *
+         * \param p_message std::string_view
+         */
+        void write(std::string_view p_message);
+
+    private:
+        char* m_map{nullptr};
+        int m_fd{-1};
+        uint32_t m_slot_index{0};
+    };
+
+    /**
+     * \class ShmChannelCollector
+     * \brief Collector end of a shared-memory log channel; the single writer
+     * of the merged output.
+     *
+     * poll() drains every producer ring, sorts the records by their shared
+     * sequence number and writes them to the file sink; start() runs poll()
+     * on a background thread until stop(). Exactly one collector per channel
+     * is expected — run it in the designated owner process.
+     */
+    class ShmChannelCollector {
+    public:
+        /**
+         * \brief Attaches to (creating if necessary) the channel [p_name].
+         * \param p_name const std::string&
+         * \param p_sink std::shared_ptr\<FileSink\> - destination of the
+         * merged output.
+         */
+        ShmChannelCollector(const std::string& p_name, std::shared_ptr< FileSink > p_sink);
+
+        ShmChannelCollector(const ShmChannelCollector& other) = delete;
+        ShmChannelCollector(ShmChannelCollector&& other) = delete;
+        ShmChannelCollector& operator=(const ShmChannelCollector& other) = delete;
+        ShmChannelCollector& operator=(ShmChannelCollector&& other) = delete;
+
+        ~ShmChannelCollector();
+
+        /**
+         * \brief Drains all producer rings once, writing the merged records
+         * to the sink.
+         * \return size_t - number of records written.
+         */
+        auto poll() -> size_t;
+
+        /**
+         * \brief Total records dropped by producers on full rings since the
+         * segment was created.
+         */
+        [[nodiscard]] auto droppedRecords() const -> uint64_t;
+
+        /**
+         * \brief Starts a background thread that polls the channel until
+         * stop().
+         * \param p_poll_interval std::chrono::milliseconds
+         */
+        void start(std::chrono::milliseconds p_poll_interval = std::chrono::milliseconds(1));
+
+        /**
+         * \brief Stops the background thread after a final drain.
+         */
+        void stop();
+
+    private:
+        char* m_map{nullptr};
+        int m_fd{-1};
+        std::shared_ptr< FileSink > m_sink;
+        std::thread m_poll_thread;
+        std::atomic< bool > m_running{false};
+    };
+
+}  // namespace mt::log
+
+#if defined(MT_LOG_HEADER_ONLY)
+  #include "shm_channel.ipp"
+#endif
+
+#endif  // MT_SHM_CHANNEL_HPP
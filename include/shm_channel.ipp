@@ -0,0 +1,304 @@
+/**
+ * \file shm_channel.ipp
+ * \brief Out-of-line definitions for shm_channel.hpp.
+ *
+ * Compiled once into the log library in the default build; included
+ * inline by the headers when MT_LOG_HEADER_ONLY is defined (the header-only
+ * CMake target does this), so short-lived tools can skip the library link.
+ */
+#ifndef MT_SHM_CHANNEL_IPP
+#define MT_SHM_CHANNEL_IPP
+
+#include "shm_channel.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+#if (defined __linux) || (defined linux) || (defined __linux__) || (defined __OSX__) || (defined __APPLE__)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+#else
+  #define NOMINMAX
+  #include <windows.h>
+#endif
+
+
+#ifndef MT_LOG_FUNC
+  #if defined(MT_LOG_HEADER_ONLY)
+    #define MT_LOG_FUNC inline
+  #else
+    #define MT_LOG_FUNC
+  #endif
+#endif
+
+namespace mt::log {
+
+    namespace shm_detail {
+
+        /**
+         * \internal
+         * \brief Segment layout: one ChannelHeader, then slot_count SlotHeaders,
+         * then slot_count data regions of slot_capacity bytes each. All headers
+         * occupy their own cache line so producers in different processes do not
+         * false-share.
+         */
+        struct ChannelHeader {
+            char magic[8];
+            std::atomic< uint32_t > state;
+            std::atomic< uint64_t > sequence;
+        };
+
+        /**
+         * \internal
+         * \brief Per-slot cursors of a single-producer byte ring. [head] and
+         * [tail] grow monotonically and are masked into the data region; a record
+         * is [uint64_t sequence][uint32_t length][length bytes] and is published
+         * by the release store to [tail], so the collector never observes a torn
+         * record.
+         */
+        struct SlotHeader {
+            std::atomic< uint64_t > owner_pid;
+            std::atomic< uint64_t > head;
+            std::atomic< uint64_t > tail;
+            std::atomic< uint64_t > dropped;
+        };
+
+        inline constexpr char channel_magic[8] = {'M', 'T', 'L', 'O', 'G', 'S', 'H', 'M'};
+        inline constexpr size_t header_size = 64;
+        inline constexpr size_t slot_header_size = 64;
+        inline constexpr size_t record_overhead = sizeof(uint64_t) + sizeof(uint32_t);
+        inline constexpr size_t channel_size =
+            header_size + ShmChannelProducer::slot_count * slot_header_size + static_cast< size_t >(ShmChannelProducer::slot_count) * ShmChannelProducer::slot_capacity;
+
+        static_assert((ShmChannelProducer::slot_capacity & (ShmChannelProducer::slot_capacity - 1)) == 0, "slot_capacity must be a power of two");
+
+        MT_LOG_FUNC auto channelHeader(char* p_map) -> ChannelHeader* { return reinterpret_cast< ChannelHeader* >(p_map); }
+
+        MT_LOG_FUNC auto slotHeader(char* p_map, const uint32_t p_index) -> SlotHeader* {
+            return reinterpret_cast< SlotHeader* >(p_map + header_size + p_index * slot_header_size);
+        }
+
+        MT_LOG_FUNC auto slotData(char* p_map, const uint32_t p_index) -> char* {
+            return p_map + header_size + ShmChannelProducer::slot_count * slot_header_size + static_cast< size_t >(p_index) * ShmChannelProducer::slot_capacity;
+        }
+
+        MT_LOG_FUNC void copyIn(char* p_data, const uint64_t p_offset, const void* p_source, const size_t p_length) {
+            const auto index = p_offset & (ShmChannelProducer::slot_capacity - 1);
+            const auto first = std::min(p_length, ShmChannelProducer::slot_capacity - index);
+            std::memcpy(p_data + index, p_source, first);
+            std::memcpy(p_data, static_cast< const char* >(p_source) + first, p_length - first);
+        }
+
+        MT_LOG_FUNC void copyOut(const char* p_data, const uint64_t p_offset, void* p_destination, const size_t p_length) {
+            const auto index = p_offset & (ShmChannelProducer::slot_capacity - 1);
+            const auto first = std::min(p_length, ShmChannelProducer::slot_capacity - index);
+            std::memcpy(p_destination, p_data + index, first);
+            std::memcpy(static_cast< char* >(p_destination) + first, p_data, p_length - first);
+        }
+
+#if (defined __linux) || (defined linux) || (defined __linux__) || (defined __OSX__) || (defined __APPLE__)
+
+        MT_LOG_FUNC auto mapChannel(const std::string& p_name, int& p_fd) -> char* {
+            p_fd = ::shm_open(p_name.c_str(), O_RDWR | O_CREAT, 0644);
+            if (p_fd < 0) {
+                throw std::system_error(errno, std::system_category(), "ShmChannel: shm_open");
+            }
+            if (::ftruncate(p_fd, static_cast< off_t >(channel_size)) != 0) {
+                ::close(p_fd);
+                throw std::system_error(errno, std::system_category(), "ShmChannel: ftruncate");
+            }
+            void* mapping = ::mmap(nullptr, channel_size, PROT_READ | PROT_WRITE, MAP_SHARED, p_fd, 0);
+            if (mapping == MAP_FAILED) {
+                ::close(p_fd);
+                throw std::system_error(errno, std::system_category(), "ShmChannel: mmap");
+            }
+            return static_cast< char* >(mapping);
+        }
+
+        MT_LOG_FUNC void unmapChannel(char* p_map, const int p_fd) {
+            if (p_map != nullptr) {
+                ::munmap(p_map, channel_size);
+            }
+            if (p_fd >= 0) {
+                ::close(p_fd);
+            }
+        }
+
+        MT_LOG_FUNC auto currentPID() -> uint64_t { return static_cast< uint64_t >(getpid()); }
+
+#else
+
+        MT_LOG_FUNC auto mapChannel(const std::string& p_name, int& p_fd) -> char* {
+            HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, static_cast< DWORD >(static_cast< uint64_t >(channel_size) >> 32),
+                                                static_cast< DWORD >(channel_size), p_name.c_str());
+            if (mapping == nullptr) {
+                throw std::system_error(static_cast< int >(GetLastError()), std::system_category(), "ShmChannel: CreateFileMapping");
+            }
+            void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, channel_size);
+            if (view == nullptr) {
+                CloseHandle(mapping);
+                throw std::system_error(static_cast< int >(GetLastError()), std::system_category(), "ShmChannel: MapViewOfFile");
+            }
+            p_fd = static_cast< int >(reinterpret_cast< intptr_t >(mapping));
+            return static_cast< char* >(view);
+        }
+
+        MT_LOG_FUNC void unmapChannel(char* p_map, const int p_fd) {
+            if (p_map != nullptr) {
+                UnmapViewOfFile(p_map);
+            }
+            if (p_fd >= 0) {
+                CloseHandle(reinterpret_cast< HANDLE >(static_cast< intptr_t >(p_fd)));
+            }
+        }
+
+        MT_LOG_FUNC auto currentPID() -> uint64_t { return static_cast< uint64_t >(GetCurrentProcessId()); }
+
+#endif
+
+        /**
+         * \internal
+         * \brief Maps the named segment and runs the one-time initialization
+         * race: the first process to flip [state] from 0 to 1 initializes, every
+         * other process waits for the ready state.
+         */
+        MT_LOG_FUNC auto attachChannel(const std::string& p_name, int& p_fd) -> char* {
+            auto* map = mapChannel(p_name, p_fd);
+            auto* header = channelHeader(map);
+            uint32_t expected = 0;
+            if (header->state.compare_exchange_strong(expected, 1, std::memory_order_acq_rel)) {
+                std::memcpy(header->magic, channel_magic, sizeof(channel_magic));
+                header->sequence.store(0, std::memory_order_relaxed);
+                header->state.store(2, std::memory_order_release);
+            } else {
+                while (header->state.load(std::memory_order_acquire) != 2) {
+                    std::this_thread::yield();
+                }
+            }
+            return map;
+        }
+
+    }  // namespace shm_detail
+
+    MT_LOG_FUNC ShmChannelProducer::ShmChannelProducer(const std::string& p_name) {
+        m_map = shm_detail::attachChannel(p_name, m_fd);
+        const auto pid = shm_detail::currentPID();
+        for (uint32_t i = 0; i < slot_count; ++i) {
+            uint64_t expected = 0;
+            if (shm_detail::slotHeader(m_map, i)->owner_pid.compare_exchange_strong(expected, pid, std::memory_order_acq_rel)) {
+                m_slot_index = i;
+                return;
+            }
+        }
+        shm_detail::unmapChannel(m_map, m_fd);
+        m_map = nullptr;
+        throw std::runtime_error("ShmChannelProducer: no free producer slot in channel " + p_name);
+    }
+
+    MT_LOG_FUNC ShmChannelProducer::~ShmChannelProducer() {
+        if (m_map != nullptr) {
+            shm_detail::slotHeader(m_map, m_slot_index)->owner_pid.store(0, std::memory_order_release);
+        }
+        shm_detail::unmapChannel(m_map, m_fd);
+    }
+
+    MT_LOG_FUNC void ShmChannelProducer::write(const std::string_view p_message) {
+        auto* slot = shm_detail::slotHeader(m_map, m_slot_index);
+        const uint64_t total = shm_detail::record_overhead + p_message.size();
+        const auto head = slot->head.load(std::memory_order_acquire);
+        const auto tail = slot->tail.load(std::memory_order_relaxed);
+        if (total > slot_capacity or tail - head + total > slot_capacity) {
+            slot->dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        const auto sequence = shm_detail::channelHeader(m_map)->sequence.fetch_add(1, std::memory_order_relaxed);
+        auto* data = shm_detail::slotData(m_map, m_slot_index);
+        const auto length = static_cast< uint32_t >(p_message.size());
+        shm_detail::copyIn(data, tail, &sequence, sizeof(sequence));
+        shm_detail::copyIn(data, tail + sizeof(sequence), &length, sizeof(length));
+        shm_detail::copyIn(data, tail + shm_detail::record_overhead, p_message.data(), length);
+        slot->tail.store(tail + total, std::memory_order_release);
+    }
+
+    MT_LOG_FUNC ShmChannelCollector::ShmChannelCollector(const std::string& p_name, std::shared_ptr< FileSink > p_sink) :
+        m_sink(std::move(p_sink)) {
+        m_map = shm_detail::attachChannel(p_name, m_fd);
+    }
+
+    MT_LOG_FUNC ShmChannelCollector::~ShmChannelCollector() {
+        stop();
+        shm_detail::unmapChannel(m_map, m_fd);
+    }
+
+    MT_LOG_FUNC auto ShmChannelCollector::poll() -> size_t {
+        struct PendingRecord {
+            uint64_t sequence;
+            std::string line;
+        };
+        std::vector< PendingRecord > records;
+        for (uint32_t i = 0; i < ShmChannelProducer::slot_count; ++i) {
+            auto* slot = shm_detail::slotHeader(m_map, i);
+            auto head = slot->head.load(std::memory_order_relaxed);
+            const auto tail = slot->tail.load(std::memory_order_acquire);
+            const auto* data = shm_detail::slotData(m_map, i);
+            while (head < tail) {
+                uint64_t sequence = 0;
+                uint32_t length = 0;
+                shm_detail::copyOut(data, head, &sequence, sizeof(sequence));
+                shm_detail::copyOut(data, head + sizeof(sequence), &length, sizeof(length));
+                std::string line(length, '\0');
+                shm_detail::copyOut(data, head + shm_detail::record_overhead, line.data(), length);
+                records.push_back({sequence, std::move(line)});
+                head += shm_detail::record_overhead + length;
+            }
+            slot->head.store(head, std::memory_order_release);
+        }
+        if (records.empty()) {
+            return 0;
+        }
+        std::sort(records.begin(), records.end(),
+                  [](const PendingRecord& p_left, const PendingRecord& p_right) -> bool { return p_left.sequence < p_right.sequence; });
+        for (const auto& l_record: records) {
+            m_sink->write(l_record.line);
+        }
+        m_sink->flush();
+        return records.size();
+    }
+
+    MT_LOG_FUNC auto ShmChannelCollector::droppedRecords() const -> uint64_t {
+        uint64_t total = 0;
+        for (uint32_t i = 0; i < ShmChannelProducer::slot_count; ++i) {
+            total += shm_detail::slotHeader(m_map, i)->dropped.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    MT_LOG_FUNC void ShmChannelCollector::start(const std::chrono::milliseconds p_poll_interval) {
+        if (m_running.exchange(true, std::memory_order_acq_rel)) {
+            return;
+        }
+        m_poll_thread = std::thread([this, p_poll_interval]() -> void {
+            while (m_running.load(std::memory_order_acquire)) {
+                poll();
+                std::this_thread::sleep_for(p_poll_interval);
+            }
+        });
+    }
+
+    MT_LOG_FUNC void ShmChannelCollector::stop() {
+        if (not m_running.exchange(false, std::memory_order_acq_rel)) {
+            return;
+        }
+        if (m_poll_thread.joinable()) {
+            m_poll_thread.join();
+        }
+        poll();
+    }
+
+}  // namespace mt::log
+
+#endif  // MT_SHM_CHANNEL_IPP
@@ -0,0 +1 @@
+#include "journal_sink.ipp"
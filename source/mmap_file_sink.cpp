@@ -0,0 +1 @@
+#include "mmap_file_sink.ipp"
@@ -0,0 +1 @@
+#include "network_sink.ipp"
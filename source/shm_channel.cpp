@@ -0,0 +1 @@
+#include "shm_channel.ipp"
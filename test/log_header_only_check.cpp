@@ -0,0 +1,24 @@
+#include "log.hpp"
+
+#include <sstream>
+
+/**
+ * Compile check for the log_header_only INTERFACE target: builds the whole
+ * library — every sink, zlib paths included when the build has zlib — with
+ * MT_LOG_HEADER_ONLY and exercises a constinit instance, so a definition
+ * that is ill-formed only in the inline configuration fails this target
+ * instead of the first downstream consumer.
+ */
+namespace {
+
+    constinit mt::log::Log<> g_log;
+
+}  // namespace
+
+auto main() -> int {
+    std::ostringstream l_captured;
+    g_log.setGlobalOutput(static_cast< std::ostream* >(&l_captured));
+    g_log.write< mt::log::MessageType::Info >("header-only check");
+    g_log.flush();
+    return l_captured.str().find("header-only check") != std::string::npos ? 0 : 1;
+}
@@ -0,0 +1,40 @@
+#include "binary_format.hpp"
+#include "log.hpp"
+
+#include <fstream>
+#include <iostream>
+
+/**
+ * Offline textualizer for binary logs produced by BinarySink.
+ *
+ * Usage: log_textualize [file...]
+ *
+ * Reads each file (or standard input when no file is given) and renders every
+ * event through the default LogEvent::toString() layout to standard output.
+ */
+namespace {
+
+    auto textualize(std::istream& p_input) -> int {
+        mt::log::BinaryLogReader l_reader{p_input};
+        while (auto l_event = l_reader.next()) {
+            std::cout << l_event->toString();
+        }
+        return 0;
+    }
+
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+    if (argc < 2) {
+        return textualize(std::cin);
+    }
+    for (int i = 1; i < argc; ++i) {
+        std::ifstream l_file{argv[i], std::ios::binary};
+        if (not l_file.is_open()) {
+            std::cerr << "log_textualize: could not open " << argv[i] << '\n';
+            return 1;
+        }
+        textualize(l_file);
+    }
+    return 0;
+}